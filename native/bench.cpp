@@ -0,0 +1,230 @@
+// Native benchmark of every engine and method: ns per value (best of a few
+// runs) and millions of values per second, as comparison tables.
+//
+//   rng_bench [--quick] [--csv] [--check-fill] [engine...]
+//
+// --quick runs few values (smoke test), --csv prints one line per
+// measure instead of the tables. --check-fill only times number() and
+// fill/4096, and fails if the bulk path is slower than a loop of number()
+// (beyond FILL_SLACK, for timing noise). Engines are named as in rng.new.
+
+#include "engines.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+// results are added here, so the compiler cannot drop the loops
+static volatile uint32_t sink;
+static volatile double double_sink;
+
+static uint32_t values = 1000000;
+static int runs = 5;
+static bool check_fill = false;
+
+#define FILL_SLACK 1.5
+
+struct Measure {
+    const char *engine;
+    std::string method;
+    double ns;
+};
+
+static std::vector<Measure> measures;
+static std::vector<std::string> methods;
+
+static void add_measure(const char *engine, const std::string &method, double ns) {
+    Measure m = { engine, method, ns };
+    measures.push_back(m);
+    for (size_t i = 0; i < methods.size(); i++) {
+        if (methods[i] == method) {
+            return;
+        }
+    }
+    methods.push_back(method);
+}
+
+// best time of runs, in ns per value; f(gen, n) draws n values
+template<class E, class F>
+static double time_values(E &gen, uint32_t n, F f) {
+    double best = 1e30;
+    for (int run = 0; run < runs; run++) {
+        Clock::time_point start = Clock::now();
+        f(gen, n);
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / n;
+        if (ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+template<class E>
+static void bench_range(E &gen, const char *engine, const char *method, uint32_t min, uint32_t max) {
+    add_measure(engine, method, time_values(gen, values, [min, max](E &g, uint32_t n) {
+        uint32_t sum = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            sum += g.range(min, max);
+        }
+        sink = sum;
+    }));
+}
+
+template<class E>
+static void bench_fill(E &gen, const char *engine, uint32_t batch) {
+    std::vector<uint32_t> out(batch);
+    char method[32];
+    snprintf(method, sizeof(method), "fill/%u", batch);
+    add_measure(engine, method, time_values(gen, values, [&out, batch](E &g, uint32_t n) {
+        for (uint32_t i = 0; i < n; i += batch) {
+            g.fill(&out[0], batch);
+        }
+        sink = out[batch - 1];
+    }));
+}
+
+template<class E>
+static void seed(E &gen) {
+    gen.set_seed(42);
+}
+
+static void seed(Pcg32 &gen) {
+    gen.set_seed(42, 54);
+}
+
+template<class E>
+static void bench(const char *engine) {
+    E gen;
+    seed(gen);
+
+    add_measure(engine, "number", time_values(gen, values, [](E &g, uint32_t n) {
+        uint32_t sum = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            sum += g.number();
+        }
+        sink = sum;
+    }));
+    if (check_fill) {
+        bench_fill(gen, engine, 4096);
+        return;
+    }
+    bench_range(gen, engine, "range6", 1, 6);
+    bench_range(gen, engine, "range1000", 1, 1000);
+    bench_range(gen, engine, "range2^31+1", 0, 0x80000000u);  // worst case rejection
+    bench_range(gen, engine, "range2^32", 0, 0xFFFFFFFFu);
+    add_measure(engine, "double", time_values(gen, values, [](E &g, uint32_t n) {
+        double sum = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            sum += g.double_num();
+        }
+        double_sink = sum;
+    }));
+    add_measure(engine, "double_range", time_values(gen, values, [](E &g, uint32_t n) {
+        double sum = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            sum += g.double_range(-1.0, 1.0);
+        }
+        double_sink = sum;
+    }));
+    add_measure(engine, "roll", time_values(gen, values, [](E &g, uint32_t n) {
+        int sum = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            sum += g.roll();
+        }
+        sink = sum;
+    }));
+    add_measure(engine, "toss", time_values(gen, values, [](E &g, uint32_t n) {
+        int sum = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            sum += g.toss();
+        }
+        sink = sum;
+    }));
+    bench_fill(gen, engine, 16);
+    bench_fill(gen, engine, 256);
+    bench_fill(gen, engine, 4096);
+}
+
+static double find(const char *engine, const std::string &method) {
+    for (size_t i = 0; i < measures.size(); i++) {
+        if (strcmp(measures[i].engine, engine) == 0 && measures[i].method == method) {
+            return measures[i].ns;
+        }
+    }
+    return 0;
+}
+
+static void print_table(const std::vector<const char*> &engines, bool per_second) {
+    printf("\n%s\n%-12s", per_second ? "millions of values per second" : "ns per value", "");
+    for (size_t m = 0; m < methods.size(); m++) {
+        printf(" %12s", methods[m].c_str());
+    }
+    printf("\n");
+    for (size_t e = 0; e < engines.size(); e++) {
+        printf("%-12s", engines[e]);
+        for (size_t m = 0; m < methods.size(); m++) {
+            double ns = find(engines[e], methods[m]);
+            printf(" %12.2f", per_second ? 1000.0 / ns : ns);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char **argv) {
+    bool csv = false;
+    std::vector<std::string> only;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            values = 4096 * 4;
+            runs = 1;
+        } else if (strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        } else if (strcmp(argv[i], "--check-fill") == 0) {
+            check_fill = true;
+        } else {
+            only.push_back(argv[i]);
+        }
+    }
+
+    std::vector<const char*> engines;
+#define ENGINE_BENCH(type, name) \
+    if (only.empty() || std::find(only.begin(), only.end(), #name) != only.end()) { \
+        bench<type>(#name); \
+        engines.push_back(#name); \
+    }
+    RNG_ENGINES(ENGINE_BENCH)
+#undef ENGINE_BENCH
+
+    if (engines.empty()) {
+        fprintf(stderr, "unknown engine\n");
+        return 1;
+    }
+    if (check_fill) {
+        int failures = 0;
+        for (size_t e = 0; e < engines.size(); e++) {
+            double number = find(engines[e], "number");
+            double fill = find(engines[e], "fill/4096");
+            bool slow = fill > number * FILL_SLACK;
+            printf("%-12s number %6.2f ns  fill/4096 %6.2f ns%s\n", engines[e], number, fill, slow ? "  SLOWER" : "");
+            failures += slow;
+        }
+        printf("%d engines with a slower fill\n", failures);
+        return failures > 0 ? 1 : 0;
+    }
+    if (csv) {
+        printf("engine,method,ns_per_value,mvalues_per_second\n");
+        for (size_t i = 0; i < measures.size(); i++) {
+            printf("%s,%s,%.3f,%.2f\n", measures[i].engine, measures[i].method.c_str(), measures[i].ns, 1000.0 / measures[i].ns);
+        }
+    } else {
+        printf("%u values per measure, best of %d runs\n", values, runs);
+        print_table(engines, false);
+        print_table(engines, true);
+    }
+    return 0;
+}
@@ -0,0 +1,545 @@
+// Golden vectors: the exact bits of every engine and method, and of the
+// noise, worley, sequence and poisson-disk code, checked against
+// native/golden.txt. Lockstep games replay the same seeds on every client,
+// so an optimization, a compiler or a platform must never change a value.
+//
+//   rng_golden golden.txt            checks, exit code 1 on any difference
+//   rng_golden --write golden.txt    rewrites the file, after a deliberate change
+//
+// Vectors hold thousands of values each (engine x method x seed, with edge
+// bounds). The file keeps, per vector, its length, a 64 bit FNV-1a hash of
+// the bits of all values (floats and doubles by their IEEE representation,
+// so -0.0 and 0.0 differ) and its first values in hex, to see where a
+// difference starts.
+
+#include "engines.hpp"
+#include "parallel.hpp"
+#include "noise.h"
+#include "worley.h"
+#include "sequence.h"
+#include "poisson.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#define GOLDEN_VALUES 4096
+#define GOLDEN_SHOWN 4
+
+struct Vector {
+    std::string name;
+    std::vector<uint64_t> bits;
+
+    void add(uint32_t value) {
+        bits.push_back(value);
+    }
+
+    void add(double value) {
+        uint64_t b;
+        memcpy(&b, &value, sizeof(b));
+        bits.push_back(b);
+    }
+
+    void add(float value) {
+        uint32_t b;
+        memcpy(&b, &value, sizeof(b));
+        bits.push_back(b);
+    }
+
+    // name count hash first values, as in golden.txt
+    std::string line() const {
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < bits.size(); i++) {
+            for (int k = 0; k < 64; k += 8) {
+                hash = (hash ^ ((bits[i] >> k) & 0xff)) * 1099511628211ull;
+            }
+        }
+        char buf[64];
+        std::string s = name;
+        snprintf(buf, sizeof(buf), " %u %016llx", (unsigned)bits.size(), (unsigned long long)hash);
+        s += buf;
+        for (size_t i = 0; i < bits.size() && i < GOLDEN_SHOWN; i++) {
+            snprintf(buf, sizeof(buf), " %llx", (unsigned long long)bits[i]);
+            s += buf;
+        }
+        return s;
+    }
+};
+
+// a deque keeps references to vectors valid while more are added
+static std::deque<Vector> vectors;
+
+static Vector &vector(const std::string &name) {
+    vectors.push_back(Vector());
+    vectors.back().name = name;
+    return vectors.back();
+}
+
+static std::string format(const char *fmt, ...) {
+    char buf[128];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    return buf;
+}
+
+static const uint32_t seeds[] = { 1, 42, 0xffffffffu };
+
+template<class E>
+static void seed(E &gen, uint32_t s) {
+    gen.set_seed(s);
+}
+
+static void seed(Pcg32 &gen, uint32_t s) {
+    gen.set_seed(s, 54);
+}
+
+// uneven chunks, to cross the block and vector boundaries of the bulk paths
+static const uint32_t fill_chunks[] = { 1, 3, 16, 17, 250, 7, 1000, 2, 624, 64 };
+
+template<class E>
+static void fill_chunked(E &gen, Vector &v) {
+    std::vector<uint32_t> out(GOLDEN_VALUES);
+    uint32_t done = 0;
+    for (int c = 0; done < GOLDEN_VALUES; c = (c + 1) % 10) {
+        uint32_t n = std::min(fill_chunks[c], GOLDEN_VALUES - done);
+        gen.fill(&out[done], n);
+        done += n;
+    }
+    for (uint32_t i = 0; i < GOLDEN_VALUES; i++) {
+        v.add(out[i]);
+    }
+}
+
+// engine specific ways to move in the sequence
+template<class E>
+static void skips(const char *, uint32_t) {
+}
+
+template<class E>
+static void advances(const char *engine, uint32_t s) {
+    E gen;
+    seed(gen, s);
+    Vector &v = vector(format("%s:%u:advance", engine, s));
+    for (uint32_t i = 0; i < GOLDEN_VALUES; i++) {
+        gen.advance(i * 977u);
+        v.add(gen.number());
+    }
+
+    seed(gen, s);
+    std::vector<uint32_t> out(GOLDEN_VALUES * 4);
+    parallel_fill(gen, (uint32_t)out.size(), 4, 1000, [&](E &lane, uint32_t first, uint32_t n) {
+        lane.fill(&out[first], n);
+    });
+    Vector &p = vector(format("%s:%u:fill_parallel", engine, s));
+    for (size_t i = 0; i < out.size(); i++) {
+        p.add(out[i]);
+    }
+}
+
+template<class E>
+static void jumps(const char *engine, uint32_t s) {
+    E gen;
+    seed(gen, s);
+    Vector &v = vector(format("%s:%u:jump", engine, s));
+    for (uint32_t i = 0; i < GOLDEN_VALUES / 2; i++) {
+        gen.jump();
+        v.add(gen.number());
+        gen.long_jump();
+        v.add(gen.number());
+    }
+}
+
+template<>
+void skips<Pcg32>(const char *engine, uint32_t s) {
+    advances<Pcg32>(engine, s);
+
+    // the legacy double_range of pcg32, number() / (2^32 - 1), max included
+    Pcg32 gen;
+    seed(gen, s);
+    Vector &v = vector(format("%s:%u:double_range(0,1)", engine, s));
+    for (uint32_t i = 0; i < GOLDEN_VALUES; i++) {
+        v.add(gen.double_range(0.0, 1.0));
+    }
+}
+
+template<>
+void skips<ChaCha8>(const char *engine, uint32_t s) {
+    advances<ChaCha8>(engine, s);
+}
+
+template<>
+void skips<ChaCha20>(const char *engine, uint32_t s) {
+    advances<ChaCha20>(engine, s);
+}
+
+template<>
+void skips<Xoshiro128>(const char *engine, uint32_t s) {
+    jumps<Xoshiro128>(engine, s);
+}
+
+template<>
+void skips<Xoshiro256>(const char *engine, uint32_t s) {
+    jumps<Xoshiro256>(engine, s);
+}
+
+template<>
+void skips<TinyMT32>(const char *engine, uint32_t s) {
+    TinyMT32 gen(513);
+    gen.set_seed(s);
+    Vector &v = vector(format("%s:%u:param_513", engine, s));
+    for (uint32_t i = 0; i < GOLDEN_VALUES; i++) {
+        v.add(gen.number());
+    }
+}
+
+template<class E>
+static void run(const char *engine) {
+    for (size_t k = 0; k < sizeof(seeds) / sizeof(seeds[0]); k++) {
+        uint32_t s = seeds[k];
+        E gen;
+#define GOLDEN_METHOD(method, expr) \
+        { \
+            seed(gen, s); \
+            Vector &v = vector(format("%s:%u:%s", engine, s, method)); \
+            for (uint32_t i = 0; i < GOLDEN_VALUES; i++) { \
+                v.add(expr); \
+            } \
+        }
+        GOLDEN_METHOD("number", gen.number());
+        GOLDEN_METHOD("double", gen.double_num());
+        GOLDEN_METHOD("double_range(-1.5,2.25)", gen.double_range(-1.5, 2.25));
+        GOLDEN_METHOD("double_range(-1e9,0.001)", gen.double_range(-1e9, 0.001));
+        GOLDEN_METHOD("double_range(0.1,0.1+1e-12)", gen.double_range(0.1, 0.1 + 1e-12));
+        GOLDEN_METHOD("range(1,6)", gen.range(1, 6));
+        GOLDEN_METHOD("range(0,1)", gen.range(0, 1));
+        GOLDEN_METHOD("range(7,7)", gen.range(7, 7));
+        GOLDEN_METHOD("range(0,2^31)", gen.range(0, 0x80000000u));
+        GOLDEN_METHOD("range(0,2^32-1)", gen.range(0, 0xffffffffu));
+        GOLDEN_METHOD("range(2^32-3,2^32-1)", gen.range(0xfffffffdu, 0xffffffffu));
+        GOLDEN_METHOD("roll", (uint32_t)gen.roll());
+        GOLDEN_METHOD("toss", (uint32_t)gen.toss());
+#undef GOLDEN_METHOD
+
+        seed(gen, s);
+        fill_chunked(gen, vector(format("%s:%u:fill", engine, s)));
+
+        // values from the prefetch ring, then from the engine again
+        seed(gen, s);
+        gen.prefetch(64);
+        Vector &p = vector(format("%s:%u:prefetch", engine, s));
+        for (uint32_t i = 0; i < GOLDEN_VALUES; i++) {
+            if (i == GOLDEN_VALUES / 2) {
+                gen.prefetch(0);
+            }
+            p.add(gen.number());
+        }
+        gen.Release();
+
+        skips<E>(engine, s);
+    }
+}
+
+// as rng.noise(rng.pcg32(s, 54), type)
+static void init_noise(noise_t *noise, uint32_t s, int type) {
+    Pcg32 gen;
+    seed(gen, s);
+    uint8_t perm[256];
+    for (int i = 0; i < 256; i++) {
+        perm[i] = i;
+    }
+    for (int i = 255; i > 0; i--) {
+        int j = gen.range(0, i);
+        uint8_t t = perm[i];
+        perm[i] = perm[j];
+        perm[j] = t;
+    }
+    uint32_t octave_seeds[NOISE_MAX_OCTAVES];
+    for (int i = 0; i < NOISE_MAX_OCTAVES; i++) {
+        octave_seeds[i] = gen.number();
+    }
+    noise_init(noise, perm, type);
+    noise_init_octaves(noise, octave_seeds);
+}
+
+// 64 x 64 grids, over negative and positive coordinates
+#define GRID 64
+#define GRID_X0 -3.7f
+#define GRID_Y0 -11.3f
+#define GRID_D 0.173f
+
+static void noise(uint32_t s, int type, const char *kind) {
+    noise_t n;
+    init_noise(&n, s, type);
+    std::vector<float> out(GRID * GRID);
+
+    Vector &s2 = vector(format("noise:%u:%s:sample2", s, kind));
+    Vector &s3 = vector(format("noise:%u:%s:sample3", s, kind));
+    for (int j = 0; j < GRID; j++) {
+        for (int i = 0; i < GRID; i++) {
+            float x = GRID_X0 + i * GRID_D, y = GRID_Y0 + j * GRID_D;
+            s2.add(noise_sample2(&n, x, y));
+            s3.add(noise_sample3(&n, x, y, x * 0.5f - y));
+        }
+    }
+    noise_fill_grid(&n, &out[0], 1, GRID_X0, GRID_Y0, GRID_D, GRID_D, GRID, GRID);
+    Vector &g = vector(format("noise:%u:%s:fill_grid", s, kind));
+    for (size_t i = 0; i < out.size(); i++) {
+        g.add(out[i]);
+    }
+
+    static const char *modes[] = { "fbm", "ridged", "billow" };
+    for (int mode = FRACTAL_FBM; mode <= FRACTAL_BILLOW; mode++) {
+        for (int warp = 0; warp < 2; warp++) {
+            fractal_t f;
+            fractal_init(&f);
+            f.octaves = 5;
+            f.mode = mode;
+            f.warp = warp ? 0.75f : 0;
+            Vector &fs = vector(format("noise:%u:%s:fractal2:%s:warp%d", s, kind, modes[mode], warp));
+            for (int j = 0; j < GRID; j++) {
+                for (int i = 0; i < GRID; i++) {
+                    fs.add(noise_fractal2(&n, &f, GRID_X0 + i * GRID_D, GRID_Y0 + j * GRID_D));
+                }
+            }
+            noise_fractal_grid(&n, &f, &out[0], 1, GRID_X0, GRID_Y0, GRID_D, GRID_D, GRID, GRID);
+            Vector &fg = vector(format("noise:%u:%s:fractal_grid:%s:warp%d", s, kind, modes[mode], warp));
+            for (size_t i = 0; i < out.size(); i++) {
+                fg.add(out[i]);
+            }
+        }
+    }
+}
+
+static void worley(uint32_t s) {
+    static const char *metrics[] = { "euclidean", "manhattan", "chebyshev" };
+    static const char *outputs[] = { "f1", "f2", "f2_f1" };
+    std::vector<float> out(GRID * GRID);
+    for (int metric = WORLEY_EUCLIDEAN; metric <= WORLEY_CHEBYSHEV; metric++) {
+        for (int output = WORLEY_F1; output <= WORLEY_F2_F1; output++) {
+            worley_t w;
+            worley_init(&w, s);
+            w.metric = metric;
+            w.output = output;
+            Vector &v = vector(format("worley:%u:%s:%s:sample2", s, metrics[metric], outputs[output]));
+            for (int j = 0; j < GRID; j++) {
+                for (int i = 0; i < GRID; i++) {
+                    float cell;
+                    v.add(worley_sample2(&w, GRID_X0 + i * GRID_D, GRID_Y0 + j * GRID_D, &cell));
+                    v.add(cell);
+                }
+            }
+            worley_fill_grid(&w, &out[0], 1, GRID_X0, GRID_Y0, GRID_D, GRID_D, GRID, GRID);
+            Vector &g = vector(format("worley:%u:%s:%s:fill_grid", s, metrics[metric], outputs[output]));
+            for (size_t i = 0; i < out.size(); i++) {
+                g.add(out[i]);
+            }
+        }
+    }
+}
+
+static void sequences(uint32_t s) {
+    static const char *types[] = { "sobol", "halton", "r2" };
+    for (int type = SEQUENCE_SOBOL; type <= SEQUENCE_R2; type++) {
+        for (int scrambled = 0; scrambled < 2; scrambled++) {
+            // as rng.sequence(type, 4, rng.pcg32(s, 54))
+            Pcg32 gen;
+            seed(gen, s);
+            uint32_t dim_seeds[SEQUENCE_MAX_DIMS];
+            for (int d = 0; d < SEQUENCE_MAX_DIMS; d++) {
+                dim_seeds[d] = gen.number();
+            }
+            sequence_t q;
+            sequence_init(&q, type, SEQUENCE_MAX_DIMS, scrambled ? dim_seeds : 0);
+            const char *mode = scrambled ? "scrambled" : "plain";
+
+            Vector &v = vector(format("sequence:%u:%s:%s:sample", s, types[type], mode));
+            double point[SEQUENCE_MAX_DIMS];
+            for (uint32_t i = 0; i < GOLDEN_VALUES / SEQUENCE_MAX_DIMS; i++) {
+                sequence_sample(&q, i * 7919u, point);  // spread over 2^23 indices
+                for (int d = 0; d < SEQUENCE_MAX_DIMS; d++) {
+                    v.add(point[d]);
+                }
+            }
+            std::vector<float> out(GOLDEN_VALUES);
+            sequence_fill(&q, 1000, GOLDEN_VALUES / SEQUENCE_MAX_DIMS, &out[0], SEQUENCE_MAX_DIMS);
+            Vector &f = vector(format("sequence:%u:%s:%s:fill", s, types[type], mode));
+            for (size_t i = 0; i < out.size(); i++) {
+                f.add(out[i]);
+            }
+        }
+    }
+}
+
+static uint32_t pcg32_next(void *ctx) {
+    return ((Pcg32*)ctx)->number();
+}
+
+static void poisson(uint32_t s) {
+    std::vector<float> density(32 * 32);
+    for (int j = 0; j < 32; j++) {
+        for (int i = 0; i < 32; i++) {
+            density[j * 32 + i] = (i + j) / 62.0f;
+        }
+    }
+    for (int dense = 0; dense < 2; dense++) {
+        poisson_t p;
+        poisson_init(&p, 120, 90, 2.5f);
+        if (dense) {
+            p.density = &density[0];
+            p.density_width = 32;
+            p.density_height = 32;
+            p.density_stride = 1;
+            p.max_radius = 8;
+        }
+        Pcg32 gen;
+        seed(gen, s);
+        std::vector<float> out(2 * (size_t)poisson_capacity(&p));
+        int count = poisson_disk(&p, pcg32_next, &gen, &out[0]);
+        Vector &v = vector(format("poisson:%u:%s", s, dense ? "density" : "uniform"));
+        v.add((uint32_t)count);
+        for (int i = 0; i < 2 * count; i++) {
+            v.add(out[i]);
+        }
+    }
+}
+
+// starts at the far corner of a 33 x 33 cell grid: 58.3363113 is 33 cells
+// of radius 2.5, and the largest uniform times it rounds to cell 33 when
+// divided by the cell size
+struct EdgeStart {
+    Pcg32 gen;
+    int calls;
+};
+
+static uint32_t edge_next(void *ctx) {
+    EdgeStart *e = (EdgeStart*)ctx;
+    return e->calls++ < 2 ? 0xffffffffu : e->gen.number();
+}
+
+static int broken;
+
+static void poisson_edge(uint32_t s) {
+    poisson_t p;
+    poisson_init(&p, 58.3363113f, 58.3363113f, 2.5f);
+    EdgeStart e;
+    seed(e.gen, s);
+    e.calls = 0;
+    std::vector<float> out(2 * (size_t)poisson_capacity(&p));
+    int count = poisson_disk(&p, edge_next, &e, &out[0]);
+    Vector &v = vector(format("poisson:%u:edge", s));
+    v.add((uint32_t)count);
+    for (int i = 0; i < 2 * count; i++) {
+        v.add(out[i]);
+    }
+    // a point filed past the last cell is missed by the neighbour search
+    for (int i = 0; i < count; i++) {
+        bool inside = out[2 * i] >= 0 && out[2 * i] < p.width && out[2 * i + 1] >= 0 && out[2 * i + 1] < p.height;
+        for (int j = i + 1; j < count && inside; j++) {
+            float dx = out[2 * i] - out[2 * j];
+            float dy = out[2 * i + 1] - out[2 * j + 1];
+            inside = dx * dx + dy * dy >= p.radius * p.radius * 0.999f;
+        }
+        if (!inside) {
+            printf("BROKEN   %s: point %d out of bounds or too close\n", v.name.c_str(), i);
+            broken++;
+            return;
+        }
+    }
+}
+
+static void compute() {
+#define ENGINE_RUN(type, name) run<type>(#name);
+    RNG_ENGINES(ENGINE_RUN)
+#undef ENGINE_RUN
+    for (size_t k = 0; k < sizeof(seeds) / sizeof(seeds[0]); k++) {
+        noise(seeds[k], NOISE_PERLIN, "perlin");
+        noise(seeds[k], NOISE_SIMPLEX, "simplex");
+        worley(seeds[k]);
+        sequences(seeds[k]);
+        poisson(seeds[k]);
+        poisson_edge(seeds[k]);
+    }
+#if RNG_PREFETCH
+    prefetch_shutdown();
+#endif
+}
+
+static int write(const char *path) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 2;
+    }
+    fprintf(f, "# golden vectors of rng_golden: name count fnv1a64 first values (hex bits)\n");
+    for (size_t i = 0; i < vectors.size(); i++) {
+        fprintf(f, "%s\n", vectors[i].line().c_str());
+    }
+    fclose(f);
+    printf("%u vectors written to %s\n", (unsigned)vectors.size(), path);
+    return 0;
+}
+
+static int check(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+    std::map<std::string, std::string> expected;
+    char buf[1024];
+    while (fgets(buf, sizeof(buf), f)) {
+        std::string line(buf);
+        while (!line.empty() && (line[line.size() - 1] == '\n' || line[line.size() - 1] == '\r')) {
+            line.erase(line.size() - 1);
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        expected[line.substr(0, line.find(' '))] = line;
+    }
+    fclose(f);
+
+    int failures = broken;
+    uint64_t values = 0;
+    for (size_t i = 0; i < vectors.size(); i++) {
+        values += vectors[i].bits.size();
+        std::string line = vectors[i].line();
+        std::map<std::string, std::string>::iterator it = expected.find(vectors[i].name);
+        if (it == expected.end()) {
+            printf("MISSING  %s\n", line.c_str());
+            failures++;
+            continue;
+        }
+        if (it->second != line) {
+            printf("DIFFERS  %s\n expected %s\n", line.c_str(), it->second.c_str());
+            failures++;
+        }
+        expected.erase(it);
+    }
+    for (std::map<std::string, std::string>::iterator it = expected.begin(); it != expected.end(); ++it) {
+        printf("GONE     %s\n", it->second.c_str());
+        failures++;
+    }
+    printf("%u vectors, %llu values, %d failed\n", (unsigned)vectors.size(), (unsigned long long)values, failures);
+    return failures > 0 ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 3 && strcmp(argv[1], "--write") == 0) {
+        compute();
+        return write(argv[2]);
+    }
+    if (argc != 2) {
+        fprintf(stderr, "usage: rng_golden [--write] golden.txt\n");
+        return 2;
+    }
+    compute();
+    return check(argv[1]);
+}
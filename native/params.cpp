@@ -0,0 +1,143 @@
+// Checks the TinyMT32 parameter sets of tinymt32_params.c: the
+// characteristic polynomial of every set, found with Berlekamp-Massey on
+// its output, must be irreducible of degree 127 (period 2^127 - 1), of
+// weight 50 to 78 like tinymt32dc's, and different from all the others, so
+// instances with different sets give independent sequences.
+//
+//   rng_params            checks the 1024 sets, exit code 1 on any failure
+//   rng_params --print    also prints each polynomial, in hex
+
+#include "tinymt32.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <bitset>
+#include <set>
+#include <string>
+
+#define DEGREE TINYMT32_MEXP
+#define SEQUENCE_BITS (4 * DEGREE)
+
+typedef std::bitset<2 * DEGREE + 2> Poly;
+
+static int degree(const Poly &p) {
+    for (int i = (int)p.size() - 1; i >= 0; i--) {
+        if (p[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Berlekamp-Massey over GF(2): the characteristic polynomial (reciprocal
+// of the connection polynomial) of the shortest recurrence giving bits
+static Poly minimal_polynomial(const std::bitset<SEQUENCE_BITS> &bits) {
+    Poly c, b;
+    c[0] = 1;
+    b[0] = 1;
+    int length = 0;
+    int shift = 1;
+    for (int n = 0; n < SEQUENCE_BITS; n++) {
+        bool d = bits[n];
+        for (int i = 1; i <= length; i++) {
+            d ^= c[i] && bits[n - i];
+        }
+        if (!d) {
+            shift++;
+        } else if (2 * length <= n) {
+            Poly t = c;
+            c ^= b << shift;
+            length = n + 1 - length;
+            b = t;
+            shift = 1;
+        } else {
+            c ^= b << shift;
+            shift++;
+        }
+    }
+    Poly p;
+    for (int i = 0; i <= length; i++) {
+        p[length - i] = c[i];
+    }
+    return p;
+}
+
+// a * b mod p, p of degree DEGREE, a and b of lower degrees
+static Poly multiply_mod(const Poly &a, const Poly &b, const Poly &p) {
+    Poly product;
+    for (int i = 0; i < DEGREE; i++) {
+        if (a[i]) {
+            product ^= b << i;
+        }
+    }
+    for (int i = 2 * DEGREE - 2; i >= DEGREE; i--) {
+        if (product[i]) {
+            product ^= p << (i - DEGREE);
+        }
+    }
+    return product;
+}
+
+// 127 is prime: p is irreducible if x^(2^127) = x mod p and p has no
+// factor of degree 1, that is no root 0 or 1
+static bool irreducible(const Poly &p) {
+    if (!p[0] || p.count() % 2 == 0) {
+        return false;
+    }
+    Poly x;
+    x[1] = 1;
+    Poly power = x;
+    for (int i = 0; i < DEGREE; i++) {
+        power = multiply_mod(power, power, p);
+    }
+    return power == x;
+}
+
+static std::string hex(const Poly &p) {
+    std::string s;
+    for (int i = DEGREE - DEGREE % 4; i >= 0; i -= 4) {
+        int digit = p[i] | p[i + 1] << 1 | p[i + 2] << 2 | p[i + 3] << 3;
+        s += "0123456789abcdef"[digit];
+    }
+    return s;
+}
+
+int main(int argc, char **argv) {
+    bool print = argc > 1 && strcmp(argv[1], "--print") == 0;
+    std::set<std::string> seen;
+    int failures = 0;
+
+    for (int id = 0; id < TINYMT32_PARAM_COUNT; id++) {
+        // the output is linear in the state: any bit of it has the
+        // characteristic polynomial of the state transition
+        TinyMT32 gen(id);
+        gen.set_seed(1);
+        std::bitset<SEQUENCE_BITS> bits;
+        for (int i = 0; i < SEQUENCE_BITS; i++) {
+            bits[i] = gen.number() & 1;
+        }
+        Poly p = minimal_polynomial(bits);
+        std::string poly = hex(p);
+        size_t weight = p.count();
+
+        const char *error = 0;
+        if (degree(p) != DEGREE) {
+            error = "degree is not 127";
+        } else if (!irreducible(p)) {
+            error = "reducible";
+        } else if (weight < 50 || weight > 78) {
+            error = "weight out of 50..78";
+        } else if (!seen.insert(poly).second) {
+            error = "same polynomial as another set";
+        }
+        if (error) {
+            printf("FAIL set %d: %s (degree %d, weight %u)\n", id, error, degree(p), (unsigned)weight);
+            failures++;
+        } else if (print) {
+            printf("%4d %s %u\n", id, poly.c_str(), (unsigned)weight);
+        }
+    }
+
+    printf("%d parameter sets, %d failed\n", TINYMT32_PARAM_COUNT, failures);
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,332 @@
+// Statistical quality checks of every engine and output method: a small
+// local battery (chi-square buckets and pairs, gap, birthday spacings,
+// serial correlation, Kolmogorov-Smirnov), to catch a broken fast path.
+// It is no replacement for PractRand or TestU01, which --raw feeds.
+//
+//   rng_quality [--quick] [engine...]     runs the battery, exit code 1 on failure
+//   rng_quality --raw engine [count]      writes number() values to stdout,
+//                                         forever without count:
+//   rng_quality --raw pcg32 | RNG_test stdin32
+//
+// Seeds are fixed, so results are the same at every run: a p-value below
+// 1e-6 fails, and above 1 - 1e-6 for chi-square tests of 16 and more
+// buckets (too uniform to be random).
+
+#include "engines.hpp"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#define FAIL_P 1e-6
+
+static uint32_t samples = 1 << 21;
+static int failures = 0;
+static int checks = 0;
+
+// fits too good also fail, where the statistic is close enough to
+// continuous: with a few buckets or a count of duplicates, p = 1 is common
+static void report(const char *engine, const char *method, const char *test, double p, bool too_good = false) {
+    bool failed = !(p >= FAIL_P) || (too_good && p > 1 - FAIL_P);
+    checks++;
+    if (failed) {
+        failures++;
+    }
+    printf("%-12s %-14s %-16s p = %-10.6f %s\n", engine, method, test, p, failed ? "FAIL" : "");
+}
+
+// regularized upper incomplete gamma function Q(a, x), series or continued
+// fraction (Numerical Recipes, gammq)
+static double gamma_q(double a, double x) {
+    if (x <= 0) {
+        return 1;
+    }
+    double front = exp(-x + a * log(x) - lgamma(a));
+    if (x < a + 1) {
+        double ap = a, term = 1 / a, sum = term;
+        for (int n = 0; n < 10000; n++) {
+            ap += 1;
+            term *= x / ap;
+            sum += term;
+            if (fabs(term) < fabs(sum) * 1e-15) {
+                break;
+            }
+        }
+        return 1 - sum * front;
+    }
+    double tiny = 1e-300;
+    double b = x + 1 - a, c = 1 / tiny, d = 1 / b, h = d;
+    for (int i = 1; i < 10000; i++) {
+        double an = -i * (i - a);
+        b += 2;
+        d = an * d + b;
+        if (fabs(d) < tiny) d = tiny;
+        c = b + an / c;
+        if (fabs(c) < tiny) c = tiny;
+        d = 1 / d;
+        double delta = d * c;
+        h *= delta;
+        if (fabs(delta - 1) < 1e-15) {
+            break;
+        }
+    }
+    return front * h;
+}
+
+// p-value of counts against equal expected counts
+static double chi_square_p(const std::vector<double> &counts, const std::vector<double> &expected) {
+    double chi2 = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        double d = counts[i] - expected[i];
+        chi2 += d * d / expected[i];
+    }
+    return gamma_q((counts.size() - 1) / 2.0, chi2 / 2);
+}
+
+static double uniform_chi_square_p(const std::vector<double> &counts) {
+    double total = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        total += counts[i];
+    }
+    return chi_square_p(counts, std::vector<double>(counts.size(), total / counts.size()));
+}
+
+// two-sided p-value of a standard normal z
+static double normal_p(double z) {
+    return erfc(fabs(z) / sqrt(2.0));
+}
+
+// lag 1 serial correlation (Knuth's estimate), about N(-1 / (n - 1), 1 / n)
+static double serial_p(const std::vector<double> &x) {
+    double n = x.size(), sum = 0, sum2 = 0, lag = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+        sum += x[i];
+        sum2 += x[i] * x[i];
+        lag += x[i] * x[(i + 1) % x.size()];
+    }
+    double r = (n * lag - sum * sum) / (n * sum2 - sum * sum);
+    return normal_p((r + 1 / (n - 1)) * sqrt(n));
+}
+
+// gaps between values below 1/2: gap r has probability 2^-(r + 1), gaps of
+// 16 and more are counted together
+static double gap_p(const std::vector<double> &x) {
+    const int t = 16;
+    std::vector<double> counts(t + 1, 0), expected(t + 1, 0);
+    int gap = 0;
+    double gaps = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+        if (x[i] < 0.5) {
+            counts[gap < t ? gap : t]++;
+            gaps++;
+            gap = 0;
+        } else {
+            gap++;
+        }
+    }
+    for (int r = 0; r < t; r++) {
+        expected[r] = gaps * ldexp(1.0, -(r + 1));
+    }
+    expected[t] = gaps * ldexp(1.0, -t);
+    return chi_square_p(counts, expected);
+}
+
+// Kolmogorov-Smirnov against the uniform distribution
+static double ks_p(std::vector<double> x) {
+    std::sort(x.begin(), x.end());
+    double n = x.size(), d = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+        d = std::max(d, std::max((i + 1) / n - x[i], x[i] - i / n));
+    }
+    double sn = sqrt(n);
+    double lambda = (sn + 0.12 + 0.11 / sn) * d;
+    if (lambda < 0.2) {
+        return 1;
+    }
+    double p = 0, sign = 1;
+    for (int k = 1; k <= 100; k++) {
+        double term = 2 * sign * exp(-2.0 * k * k * lambda * lambda);
+        p += term;
+        if (fabs(term) < 1e-12) {
+            break;
+        }
+        sign = -sign;
+    }
+    return std::min(std::max(p, 0.0), 1.0);
+}
+
+// birthday spacings (Marsaglia): m birthdays in a year of 2^bits days (the
+// low bits of the values), duplicate spacings are Poisson with mean
+// m^3 / (4 * 2^bits); the total over all rounds is compared to its mean
+static double birthday_p(const std::vector<uint32_t> &v, int bits, uint32_t m) {
+    uint64_t mask = bits == 32 ? 0xFFFFFFFFu : ((uint64_t)1 << bits) - 1;
+    double lambda = (double)m * m * m / (4 * ldexp(1.0, bits));
+    std::vector<uint32_t> days(m), spacings(m);
+    double duplicates = 0, rounds = 0;
+    for (size_t start = 0; start + m <= v.size(); start += m) {
+        for (uint32_t i = 0; i < m; i++) {
+            days[i] = (uint32_t)(v[start + i] & mask);
+        }
+        std::sort(days.begin(), days.end());
+        spacings[0] = days[0];
+        for (uint32_t i = 1; i < m; i++) {
+            spacings[i] = days[i] - days[i - 1];
+        }
+        std::sort(spacings.begin(), spacings.end());
+        for (uint32_t i = 1; i < m; i++) {
+            duplicates += spacings[i] == spacings[i - 1];
+        }
+        rounds++;
+    }
+    double mean = rounds * lambda;
+    return normal_p((duplicates - mean) / sqrt(mean));
+}
+
+static void test_unit(const char *engine, const char *method, const std::vector<double> &x) {
+    std::vector<double> counts(256, 0);
+    for (size_t i = 0; i < x.size(); i++) {
+        counts[(int)(x[i] * 256)]++;
+    }
+    report(engine, method, "chi2 256", uniform_chi_square_p(counts), true);
+    report(engine, method, "ks", ks_p(x));
+    report(engine, method, "gap", gap_p(x), true);
+    report(engine, method, "serial", serial_p(x));
+}
+
+static void test_u32(const char *engine, const char *method, const std::vector<uint32_t> &v) {
+    std::vector<double> high(256, 0), low(256, 0), x(v.size());
+    for (size_t i = 0; i < v.size(); i++) {
+        high[v[i] >> 24]++;
+        low[v[i] & 255]++;
+        x[i] = v[i] * (1.0 / 4294967296.0);
+    }
+    report(engine, method, "chi2 high byte", uniform_chi_square_p(high), true);
+    report(engine, method, "chi2 low byte", uniform_chi_square_p(low), true);
+    report(engine, method, "birthday 32", birthday_p(v, 32, 4096));
+    report(engine, method, "birthday low 24", birthday_p(v, 24, 512));
+    report(engine, method, "gap", gap_p(x), true);
+    report(engine, method, "serial", serial_p(x));
+}
+
+// values of a k value range, in buckets (range 2^31 + 1 goes into 256)
+static void test_discrete(const char *engine, const char *method, const std::vector<uint32_t> &v, uint64_t k) {
+    uint32_t lo = *std::min_element(v.begin(), v.end());
+    uint32_t hi = *std::max_element(v.begin(), v.end());
+    if (k <= 256 && hi - lo + 1 != k) {
+        report(engine, method, "bounds", 0);
+        return;
+    }
+    uint32_t buckets = k <= 256 ? (uint32_t)k : 256;
+    std::vector<double> counts(buckets, 0), x(v.size());
+    for (size_t i = 0; i < v.size(); i++) {
+        uint32_t b = (uint32_t)((v[i] - lo) * (double)buckets / k);
+        counts[b]++;
+        x[i] = (v[i] - lo) / (double)k;
+    }
+    report(engine, method, "chi2", uniform_chi_square_p(counts), buckets >= 16);
+    if (buckets <= 100) {
+        std::vector<double> pairs(buckets * buckets, 0);
+        for (size_t i = 0; i + 1 < v.size(); i += 2) {
+            pairs[(v[i] - lo) * buckets + (v[i + 1] - lo)]++;
+        }
+        report(engine, method, "chi2 pairs", uniform_chi_square_p(pairs), true);
+    }
+    report(engine, method, "serial", serial_p(x));
+}
+
+template<class E>
+static void seed(E &gen) {
+    gen.set_seed(12345);
+}
+
+static void seed(Pcg32 &gen) {
+    gen.set_seed(12345, 54);
+}
+
+template<class E>
+static void run(const char *engine) {
+    E gen;
+    seed(gen);
+    std::vector<uint32_t> v(samples);
+    std::vector<double> x(samples);
+
+    for (uint32_t i = 0; i < samples; i++) v[i] = gen.number();
+    test_u32(engine, "number", v);
+    for (uint32_t i = 0; i < samples; i += 1000) {
+        gen.fill(&v[i], std::min(1000u, samples - i));
+    }
+    test_u32(engine, "fill", v);
+
+    for (uint32_t i = 0; i < samples; i++) x[i] = gen.double_num();
+    test_unit(engine, "double", x);
+    for (uint32_t i = 0; i < samples; i++) x[i] = (gen.double_range(-1.0, 3.0) + 1) / 4;
+    test_unit(engine, "double_range", x);
+
+    for (uint32_t i = 0; i < samples; i++) v[i] = gen.range(1, 6);
+    test_discrete(engine, "range 6", v, 6);
+    for (uint32_t i = 0; i < samples; i++) v[i] = gen.range(1, 100);
+    test_discrete(engine, "range 100", v, 100);
+    for (uint32_t i = 0; i < samples; i++) v[i] = gen.range(0, 0x80000000u);
+    test_discrete(engine, "range 2^31+1", v, 0x80000001u);
+    for (uint32_t i = 0; i < samples; i++) v[i] = gen.roll();
+    test_discrete(engine, "roll", v, 6);
+    for (uint32_t i = 0; i < samples; i++) v[i] = gen.toss();
+    test_discrete(engine, "toss", v, 2);
+}
+
+template<class E>
+static int raw(uint64_t count) {
+    E gen;
+    seed(gen);
+#if defined(_WIN32)
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    uint32_t block[4096];
+    for (uint64_t done = 0; count == 0 || done < count; done += 4096) {
+        uint32_t n = count == 0 || count - done >= 4096 ? 4096 : (uint32_t)(count - done);
+        gen.fill(block, n);
+        if (fwrite(block, sizeof(uint32_t), n, stdout) != n) {
+            return 0;  // reader closed the pipe
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc >= 3 && strcmp(argv[1], "--raw") == 0) {
+        uint64_t count = argc >= 4 ? strtoull(argv[3], 0, 10) : 0;
+#define ENGINE_RAW(type, name) \
+        if (strcmp(argv[2], #name) == 0) return raw<type>(count);
+        RNG_ENGINES(ENGINE_RAW)
+#undef ENGINE_RAW
+        fprintf(stderr, "unknown engine '%s'\n", argv[2]);
+        return 2;
+    }
+
+    std::vector<std::string> only;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            samples = 1 << 17;
+        } else {
+            only.push_back(argv[i]);
+        }
+    }
+
+#define ENGINE_RUN(type, name) \
+    if (only.empty() || std::find(only.begin(), only.end(), #name) != only.end()) { \
+        run<type>(#name); \
+    }
+    RNG_ENGINES(ENGINE_RUN)
+#undef ENGINE_RUN
+
+    printf("%d checks on %u samples each, %d failed\n", checks, samples, failures);
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,113 @@
+-- LuaJIT FFI fast path for the generators.
+--
+--	local rngffi = require "rng.ffi"
+--	local gen = rngffi.wrap(rng.pcg32(42, 54))
+--	gen:number() -- same values as the generator, but compiled into traces
+--
+-- The wrapper calls the flat C ABI of rng_ffi.h, so the JIT can compile
+-- loops drawing numbers, which the classic Lua C API calls prevent.
+-- Without the FFI or with the JIT off (HTML5, iOS), wrap returns the
+-- generator itself, so code using it works everywhere.
+
+local M = {}
+
+local ok, ffi = pcall(require, "ffi")
+
+M.available = ok and jit ~= nil and jit.status() and rng.ffi_api ~= nil
+
+local classes = {}
+
+-- bounds of range, truncated to uint32_t like the C binding does, so the
+-- checks below see the values the generator gets
+local uint32 = ok and ffi.typeof("uint32_t")
+
+local function to_uint32(value)
+	return tonumber(uint32(value))
+end
+
+local function range_error()
+	error("min cannot be bigger than max", 3)
+end
+
+-- methods of the wrappers of one generator type
+local function create_class(name, api, gen)
+	local next = ffi.cast("uint32_t (*)(void *)", api.next)
+	local double = ffi.cast("double (*)(void *)", api.double)
+	local range = ffi.cast("uint32_t (*)(void *, uint32_t, uint32_t)", api.range)
+	local double_range = ffi.cast("double (*)(void *, double, double)", api.double_range)
+	local roll = ffi.cast("int (*)(void *)", api.roll)
+	local toss = ffi.cast("int (*)(void *)", api.toss)
+	local fill_u32 = ffi.cast("void (*)(void *, uint32_t *, uint32_t)", api.fill_u32)
+
+	local class = {}
+	class.__index = class
+
+	-- other methods (seed, jump, poisson_disk, ...) go to the generator
+	for method, func in pairs(getmetatable(gen)) do
+		class[method] = function(self, ...)
+			return func(self.gen, ...)
+		end
+	end
+
+	function class:number()
+		return next(self.gen)
+	end
+
+	function class:double()
+		return double(self.gen)
+	end
+
+	function class:range(min, max)
+		min, max = to_uint32(min), to_uint32(max)
+		if min == max then
+			return min
+		elseif min > max then
+			range_error()
+		end
+		return range(self.gen, min, max)
+	end
+
+	function class:double_range(min, max)
+		if min == max then
+			return min
+		elseif min > max then
+			range_error()
+		end
+		return double_range(self.gen, min, max)
+	end
+
+	function class:roll()
+		return roll(self.gen)
+	end
+
+	function class:toss()
+		return toss(self.gen)
+	end
+
+	-- writes count numbers to a uint32_t array (cdata)
+	function class:fill(out, count)
+		fill_u32(self.gen, out, count)
+	end
+
+	return class
+end
+
+-- returns a wrapper of gen with JIT compiled number, double, range,
+-- double_range, roll, toss and fill, and all other methods of gen
+function M.wrap(gen)
+	if not M.available then
+		return gen
+	end
+	local name = rng.engine(gen)
+	if not name then
+		error("not a generator", 2)
+	end
+	local class = classes[name]
+	if not class then
+		class = create_class(name, rng.ffi_api()[name], gen)
+		classes[name] = class
+	end
+	return setmetatable({ gen = gen }, class)
+end
+
+return M
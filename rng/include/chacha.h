@@ -0,0 +1,73 @@
+#ifndef CHACHA_H
+#define CHACHA_H
+/**
+ * @file chacha.h
+ *
+ * @brief ChaCha8 / ChaCha20 stream cipher used as a random number generator
+ *
+ * D. J. Bernstein, "ChaCha, a variant of Salsa20" (2008). The output is the
+ * keystream of the original construction (64 bit block counter, 64 bit
+ * nonce), so it is unpredictable as long as the 256 bit key is secret.
+ *
+ * Blocks are generated CHACHA_BLOCKS at a time into a buffer, with AVX2
+ * (when the CPU supports it), SSE2 or NEON. All paths produce the same
+ * keystream as the scalar one.
+ */
+
+#include <stdint.h>
+
+#define CHACHA_BLOCKS 8
+#define CHACHA_BUFFER (16 * CHACHA_BLOCKS)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * chacha internal state: key, position and buffered keystream
+ */
+struct CHACHA_T {
+    uint32_t buffer[CHACHA_BUFFER];
+    uint32_t key[8];
+    uint64_t counter;
+    uint64_t nonce;
+    int rounds;
+    int index;
+};
+
+typedef struct CHACHA_T chacha_t;
+
+/**
+ * Sets the key and nonce, and restarts the keystream at block 0.
+ * @param rounds 8 or 20 (any even number works)
+ */
+void chacha_init(chacha_t * random, const uint32_t key[8], uint64_t nonce, int rounds);
+
+/**
+ * Generates the next CHACHA_BLOCKS blocks into the buffer.
+ * Users should not call this function directly.
+ */
+void chacha_refill(chacha_t * random);
+
+/**
+ * Moves the keystream position delta words ahead, in constant time
+ * (the block counter is set directly, at most one refill).
+ */
+void chacha_advance(chacha_t * random, uint64_t delta);
+
+/**
+ * This function outputs the next 32 bit word of the keystream.
+ * @param random chacha state
+ */
+inline static uint32_t chacha_next(chacha_t * random) {
+    if (random->index >= CHACHA_BUFFER) {
+        chacha_refill(random);
+    }
+    return random->buffer[random->index++];
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "chacha.h"
+#include "xoshiro.h"
+#include "engine.hpp"
+#include "entropy.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+class ChaCha : public Engine<ChaCha>
+{
+	private:
+	chacha_t state;
+	int rounds;
+
+	public:
+	ChaCha(int rounds = 8): rounds(rounds) { set_seed(0); };
+
+	~ChaCha() { Release(); }
+
+	// reproducible key, expanded from a 64 bit seed (not secret!); the
+	// nonce selects one of 2^64 independent streams of that key
+	void set_seed(uint64_t seed, uint64_t nonce = 0) {
+		uint32_t key[8];
+		for (int i = 0; i < 8; i += 2) {
+			uint64_t k = splitmix64_next(&seed);
+			key[i] = (uint32_t)k;
+			key[i + 1] = (uint32_t)(k >> 32);
+		}
+		chacha_init(&state, key, nonce, rounds);
+	}
+
+	// secret 256 bit key and nonce, taken from entropy
+	void set_random_seed() {
+		uint32_t key[10];
+		if (!entropy_getbytes((void *)key, sizeof(key))) {
+			fallback_entropy_getbytes((void *)key, sizeof(key));
+		}
+		chacha_init(&state, key, key[8] | ((uint64_t)key[9] << 32), rounds);
+	}
+
+	uint32_t step() {
+		return chacha_next(&state);
+	}
+
+	// the C state, for rng_api.h
+	chacha_t *native_state() {
+		return &state;
+	}
+
+	// skips delta numbers, by moving the block counter
+	void advance(uint64_t delta) {
+		chacha_advance(&state, delta);
+	}
+
+	// 53 random bits, from two words
+	double double_num() {
+		uint32_t a = number() >> 5, b = number() >> 6;
+		return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+	}
+
+	// copies whole runs of the buffered keystream
+	void fill(uint32_t *out, uint32_t count) {
+		if (prefetched()) {
+			Engine<ChaCha>::fill(out, count);  // the ring comes first
+			return;
+		}
+		while (count > 0) {
+			if (state.index >= CHACHA_BUFFER) {
+				chacha_refill(&state);
+			}
+			uint32_t n = CHACHA_BUFFER - state.index;
+			if (n > count) {
+				n = count;
+			}
+			memcpy(out, state.buffer + state.index, n * sizeof(uint32_t));
+			count_draws(n);
+			fingerprint_add(out, n);
+			state.index += n;
+			out += n;
+			count -= n;
+		}
+	}
+};
+
+class ChaCha8 : public ChaCha
+{
+	public:
+	ChaCha8(): ChaCha(8) {};
+};
+
+class ChaCha20 : public ChaCha
+{
+	public:
+	ChaCha20(): ChaCha(20) {};
+};
@@ -0,0 +1,309 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "fingerprint.hpp"
+#include "prefetch.hpp"
+#include "stats.hpp"
+
+// Common method set of all generators, built on the engine's step().
+//
+// An engine derives from Engine<itself, Raw> and provides:
+//   Raw step();                    steps the state, returns the raw output
+//   void set_seed(...);            reproducible seed
+//   void set_random_seed();        seed from entropy
+// Raw is the type of one step's output: uint32_t, or uint64_t for 64 bit
+// engines, whose number() is the upper half. All methods draw through
+// next() and never touch the state otherwise, so with a prefetch ring
+// (prefetch.hpp) they get the very same values from the ring. The ring is
+// not a member: an engine is only its state, plus the counters of the
+// RNG_STATS and RNG_FINGERPRINT builds.
+// An engine can hide any method below with a faster (or legacy) version:
+// since calls go through self(), the base methods always use the engine's
+// own version, without virtual dispatch.
+template<class E, class Raw = uint32_t>
+class Engine
+{
+	E &self() { return *static_cast<E*>(this); }
+
+#if RNG_STATS
+	RngStats counts;
+#endif
+
+#if RNG_FINGERPRINT
+	RngFingerprint print;
+#endif
+
+#if RNG_PREFETCH
+	// the prefetch ring, kept out of the engine (prefetch.hpp), or 0
+	EngineRing<E, Raw> *ring() const {
+		return prefetch_any() ? static_cast<EngineRing<E, Raw>*>(prefetch_find(this)) : 0;
+	}
+
+	static uint32_t ring_size(uint32_t capacity) {
+		uint32_t size = PREFETCH_MIN_CAPACITY;
+		while (size < capacity && size < PREFETCH_MAX_CAPACITY) {
+			size *= 2;
+		}
+		return size;
+	}
+
+	// out of line, so that next() stays small enough to inline in loops
+#if defined(__GNUC__)
+	__attribute__((noinline))
+#endif
+	Raw prefetch_next(EngineRing<E, Raw> *ring) {
+		Raw value;
+		if (ring->pop(value)) {
+			return value;
+		}
+		if (ring->is_attached()) {
+			return ring->underflow();
+		}
+		prefetch_remove(this);  // stopped and drained
+		delete ring;
+		return self().step();
+	}
+#endif
+
+	protected:
+	// the 32 bit number of a raw output: the upper half of 64 bit ones
+	static uint32_t number_of(Raw raw) {
+		return (uint32_t)(raw >> (sizeof(Raw) * 8 - 32));
+	}
+
+	// counts draws made without next(), by bulk paths
+	void count_draws(uint64_t n) {
+#if RNG_STATS
+		counts.draws += n;
+		rng_global_stats().draws.fetch_add(n, std::memory_order_relaxed);
+#else
+		(void)n;
+#endif
+	}
+
+	// hashes values given without next(), by bulk paths
+	void fingerprint_add(const Raw *values, uint32_t n) {
+#if RNG_FINGERPRINT
+		for (uint32_t i = 0; i < n; i++) {
+			print.add(values[i]);
+		}
+#else
+		(void)values;
+		(void)n;
+#endif
+	}
+
+	// next raw output, from the prefetch ring when there is one
+	Raw next() {
+		count_draws(1);
+#if RNG_PREFETCH
+		EngineRing<E, Raw> *ring = this->ring();
+		if (ring) {
+			return fingerprinted(prefetch_next(ring));
+		}
+#endif
+		return fingerprinted(self().step());
+	}
+
+	Raw fingerprinted(Raw raw) {
+#if RNG_FINGERPRINT
+		print.add(raw);
+#endif
+		return raw;
+	}
+
+	public:
+	// Starts prefetching into a ring of capacity values (rounded up to a
+	// power of 2), resizes the ring, or stops with 0. Values already
+	// prefetched are still used first, so the sequence never changes.
+	// Returns whether prefetching is on (never on HTML5, nor for more than
+	// PREFETCH_MAX_RINGS engines at once). While values are prefetched,
+	// draw only from the calling thread, the one the ring is looked up on.
+	bool prefetch(uint32_t capacity) {
+#if RNG_PREFETCH
+		EngineRing<E, Raw> *old = ring();
+		if (old && old->is_attached()) {
+			if (capacity > 0 && old->capacity() == ring_size(capacity)) {
+				return true;
+			}
+			old->detach();
+		}
+		if (capacity == 0) {
+			return false;
+		}
+		if (old && old->size() > capacity) {
+			capacity = old->size();  // never shrinks below what is left
+		}
+		EngineRing<E, Raw> *ring = new EngineRing<E, Raw>(&self(), ring_size(capacity));
+		if (!prefetch_insert(this, ring)) {
+			delete ring;  // table full, and no old ring to keep
+			return false;
+		}
+		if (old) {
+			ring->take(*old);
+			delete old;
+		}
+		ring->attach();
+		return true;
+#else
+		(void)capacity;
+		return false;
+#endif
+	}
+
+	// capacity of the running prefetch ring, 0 when not prefetching
+	uint32_t prefetch_capacity() const {
+#if RNG_PREFETCH
+		EngineRing<E, Raw> *ring = this->ring();
+		return ring && ring->is_attached() ? ring->capacity() : 0;
+#else
+		return 0;
+#endif
+	}
+
+	// true while values prefetched from the current state are left, when
+	// the state cannot be changed in place (jump)
+	bool prefetched() const {
+#if RNG_PREFETCH
+		EngineRing<E, Raw> *ring = this->ring();
+		return ring && (ring->is_attached() || ring->size() > 0);
+#else
+		return false;
+#endif
+	}
+
+	// stops prefetching and drops the prefetched values, before seeding:
+	// returns the capacity to restart with
+	uint32_t prefetch_drop() {
+		uint32_t capacity = prefetch_capacity();
+#if RNG_PREFETCH
+		EngineRing<E, Raw> *ring = this->ring();
+		if (ring) {
+			prefetch_remove(this);
+			delete ring;
+		}
+#endif
+		return capacity;
+	}
+
+	uint32_t number() {
+		return number_of(next());
+	}
+
+	// unbiased, same rejection scheme as pcg32_boundedrand_r
+	uint32_t range(uint32_t min, uint32_t max) {
+		uint32_t bound = max - min + 1;
+		if (bound == 0) {
+			return self().number();  // full 32 bit range
+		}
+		uint32_t threshold = -bound % bound;
+		for (;;) {
+			uint32_t r = self().number();
+			if (r >= threshold)
+				return r % bound + min;
+#if RNG_STATS
+			counts.rejections++;
+			rng_global_stats().rejections.fetch_add(1, std::memory_order_relaxed);
+#endif
+		}
+	}
+
+	// 32 random bits in [0, 1), same value as ldexp(number(), -32)
+	double double_num() {
+		return self().number() * (1.0 / 4294967296.0);
+	}
+
+	double double_range(double min, double max) {
+		return self().double_num() * (max - min) + min;
+	}
+
+	int roll() {
+		return self().range(1, 6);
+	}
+
+	int toss() {
+		return self().range(0, 1);
+	}
+
+	// writes the next count numbers, same sequence as calling number()
+	void fill(uint32_t *out, uint32_t count) {
+#if RNG_PREFETCH
+		if (ring()) {
+			for (uint32_t i = 0; i < count; i++) {
+				out[i] = self().number();
+			}
+			return;
+		}
+#endif
+		// stepping directly keeps the state in registers, as long as the
+		// stores cannot alias it: out may point into a uint32_t state, so
+		// values go through a local block, copied out once full
+		count_draws(count);
+		E &engine = self();
+		uint32_t block[64];
+		for (uint32_t done = 0; done < count; done += 64) {
+			uint32_t n = count - done < 64 ? count - done : 64;
+			for (uint32_t i = 0; i < n; i++) {
+				block[i] = number_of(fingerprinted(engine.step()));
+			}
+			memcpy(out + done, block, n * sizeof(uint32_t));
+		}
+	}
+
+	// counts a bulk request of count values, made by the bindings
+	void count_batch(uint32_t count) {
+#if RNG_STATS
+		counts.batches++;
+		counts.batch_values += count;
+		if (count > counts.max_batch) {
+			counts.max_batch = count;
+		}
+		RngGlobalStats &global = rng_global_stats();
+		global.batches.fetch_add(1, std::memory_order_relaxed);
+		global.batch_values.fetch_add(count, std::memory_order_relaxed);
+		uint64_t max = global.max_batch.load(std::memory_order_relaxed);
+		while (count > max && !global.max_batch.compare_exchange_weak(max, count, std::memory_order_relaxed)) {
+		}
+#else
+		(void)count;
+#endif
+	}
+
+#if RNG_STATS
+	const RngStats &stats() const {
+		return counts;
+	}
+
+	void stats_reset() {
+		counts = RngStats();
+	}
+
+	// draws made by copies of this engine (parallel lanes), already in
+	// the totals
+	void stats_add_draws(uint64_t n) {
+		counts.draws += n;
+	}
+#endif
+
+#if RNG_FINGERPRINT
+	const RngFingerprint &fingerprint() const {
+		return print;
+	}
+
+	// parallel lanes hash their chunk from scratch, then the engine
+	// appends the chunks in order
+	void fingerprint_reset() {
+		print = RngFingerprint();
+	}
+
+	void fingerprint_append(const RngFingerprint &next) {
+		print.append(next);
+	}
+#endif
+
+	void Release() {
+		prefetch_drop();
+	}
+};
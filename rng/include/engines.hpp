@@ -0,0 +1,32 @@
+#pragma once
+
+#include "pcg_basic.h"
+#include "pcg.h"
+#include "tinymt32.hpp"
+#include "tinymt64.hpp"
+#include "xoshiro.hpp"
+#include "sfmt.hpp"
+#include "chacha.hpp"
+#include "smallrng.hpp"
+
+// every generator: engine type (also its Lua class name) and constructor name
+#define RNG_ENGINES(X) \
+    X(Pcg32, pcg32) \
+    X(TinyMT32, tinymt32) \
+    X(TinyMT64, tinymt64) \
+    X(Xoshiro128, xoshiro128) \
+    X(Xoshiro256, xoshiro256) \
+    X(Sfmt19937, sfmt19937) \
+    X(ChaCha8, chacha8) \
+    X(ChaCha20, chacha20) \
+    X(Wyrand, wyrand) \
+    X(Sfc32, sfc32) \
+    X(Sfc64, sfc64) \
+    X(RomuDuoJr, romuduojr)
+
+// userdata of an engine: only the engine, so an instance costs the size of
+// its state; its metatable tells its type (LuaEngine in rng.cpp)
+template<class E>
+struct EngineUserdata {
+    E engine;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+
+// Desync detection (gen:fingerprint, rng.fingerprints): each engine keeps a
+// rolling hash of every raw value it gives, and their count. Lockstep
+// clients compare fingerprints to find the first generator that diverged.
+// Off by default; build with RNG_FINGERPRINT=1 (ext.manifest defines), it
+// then costs two multiplies per draw.
+//
+// The hash is a polynomial over the mixed values, h = h * M + mix(v) modulo
+// 2^64: the fingerprint of a sequence can be appended to another, so bulk
+// fills split over threads (parallel.hpp) give the same fingerprint as one
+// fill. mix is a bijection and M is odd, so changing any single value
+// always changes the hash.
+#ifndef RNG_FINGERPRINT
+#define RNG_FINGERPRINT 0
+#endif
+
+#if RNG_FINGERPRINT
+
+#define FINGERPRINT_MULTIPLIER 0x9e3779b97f4a7c15ull
+
+struct RngFingerprint {
+	uint64_t hash;
+	uint64_t draws;
+
+	RngFingerprint(): hash(0), draws(0) {}
+
+	void add(uint64_t value) {
+		value *= 0xbf58476d1ce4e5b9ull;
+		hash = hash * FINGERPRINT_MULTIPLIER + (value ^ (value >> 31));
+		draws++;
+	}
+
+	// becomes the fingerprint of these values followed by those of next
+	void append(const RngFingerprint &next) {
+		uint64_t power = 1;
+		uint64_t base = FINGERPRINT_MULTIPLIER;
+		for (uint64_t n = next.draws; n > 0; n >>= 1) {
+			if (n & 1) {
+				power *= base;
+			}
+			base *= base;
+		}
+		hash = hash * power + next.hash;
+		draws += next.draws;
+	}
+};
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef NOISE_H
+#define NOISE_H
+/**
+ * @file noise.h
+ *
+ * @brief Seeded gradient noise (Perlin and simplex, 2D and 3D)
+ *
+ * The lattice hashing uses a 256 entry permutation table which is supplied
+ * by the caller (usually shuffled with one of the generators of this
+ * extension), so the same generator seed always yields the same noise field.
+ *
+ * noise_fill_grid evaluates a whole w x h chunk in one call. Only Perlin
+ * rows are vectorized (four samples at a time with SSE2 or NEON, also for
+ * unwarped fractal grids); simplex and warped grids stay scalar. The vector
+ * path performs exactly the same float operations as the scalar one, so
+ * both produce the same bits.
+ *
+ * Fractal sums (fBm, ridged, billow, optional domain warp) layer up to
+ * NOISE_MAX_OCTAVES octaves, each shifted by an offset derived from the seed
+ * so octaves are decorrelated. Results only depend on IEEE single precision
+ * add/mul, so build without floating point contraction (-ffp-contract=off)
+ * to keep them bit-identical across platforms.
+ */
+
+#include <stdint.h>
+
+#define NOISE_PERLIN 0
+#define NOISE_SIMPLEX 1
+
+#define NOISE_MAX_OCTAVES 16
+
+#define FRACTAL_FBM 0
+#define FRACTAL_RIDGED 1
+#define FRACTAL_BILLOW 2
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * noise internal state: permutation table (duplicated to avoid wrapping)
+ * and per octave lattice offsets
+ */
+struct NOISE_T {
+    uint8_t perm[512];
+    float offset[NOISE_MAX_OCTAVES][2];
+    int type;
+};
+
+typedef struct NOISE_T noise_t;
+
+/**
+ * fractal sum parameters; a gain of 0 or more keeps the sum of the octave
+ * amplitudes positive (with a negative gain it can be 0, and the sum is
+ * then 0 everywhere)
+ */
+struct FRACTAL_T {
+    int octaves;
+    int mode;
+    float frequency;
+    float lacunarity;
+    float gain;
+    float warp;
+};
+
+typedef struct FRACTAL_T fractal_t;
+
+void noise_init(noise_t * noise, const uint8_t perm[256], int type);
+void noise_init_octaves(noise_t * noise, const uint32_t seeds[NOISE_MAX_OCTAVES]);
+void fractal_init(fractal_t * fractal);
+
+float noise_perlin2(const noise_t * noise, float x, float y);
+float noise_perlin3(const noise_t * noise, float x, float y, float z);
+float noise_simplex2(const noise_t * noise, float x, float y);
+float noise_simplex3(const noise_t * noise, float x, float y, float z);
+
+/**
+ * Samples the noise with its configured type.
+ * @return noise value, roughly in [-1, 1]
+ */
+float noise_sample2(const noise_t * noise, float x, float y);
+float noise_sample3(const noise_t * noise, float x, float y, float z);
+
+/**
+ * Fills a w x h grid, row major, with samples taken at
+ * (x0 + i * dx, y0 + j * dy). Value (i, j) is written to
+ * out[(j * w + i) * stride].
+ */
+void noise_fill_grid(const noise_t * noise, float * out, uint32_t stride,
+                     float x0, float y0, float dx, float dy,
+                     uint32_t w, uint32_t h);
+
+/**
+ * Samples the 2D fractal sum at (x, y).
+ * @return fbm and billow values roughly in [-1, 1], ridged in [0, 1]
+ */
+float noise_fractal2(const noise_t * noise, const fractal_t * fractal,
+                     float x, float y);
+
+/**
+ * Fills a w x h grid with fractal samples, like noise_fill_grid.
+ * Unwarped Perlin grids evaluate each octave row by row with the vector
+ * path, so values may differ from noise_fractal2 in the last bits, but
+ * are the same on every platform.
+ */
+void noise_fractal_grid(const noise_t * noise, const fractal_t * fractal,
+                        float * out, uint32_t stride,
+                        float x0, float y0, float dx, float dy,
+                        uint32_t w, uint32_t h);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h>
+
+// Parallel bulk fill (gen:fill_parallel), for engines that can skip ahead
+// cheaply with advance(delta): PCG32 (LCG jump ahead) and ChaCha (block
+// counter). The output is cut into chunks of a fixed size, and chunk k is
+// generated by a copy of the engine advanced by k * chunk numbers, so the
+// values are the same as fill() gives, whatever the number of threads.
+//
+// No threads on HTML5: there everything runs on the calling thread.
+#if !defined(__EMSCRIPTEN__)
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+#define PARALLEL_DEFAULT_CHUNK 65536
+#define PARALLEL_MAX_THREADS 64
+
+// threads to use by default: one per core
+inline uint32_t parallel_default_threads() {
+#if !defined(__EMSCRIPTEN__)
+	uint32_t cores = std::thread::hardware_concurrency();
+	if (cores > PARALLEL_MAX_THREADS) {
+		return PARALLEL_MAX_THREADS;
+	}
+	return cores > 0 ? cores : 1;
+#else
+	return 1;
+#endif
+}
+
+// Draws count numbers with engine, over threads threads (the calling one
+// included), chunk numbers at a time: store(lane, first, n) must draw n
+// numbers from lane (a copy of the engine, advanced to number first) and
+// store them. The engine ends up count numbers further, as after fill().
+// With prefetched values, the engine cannot be copied ahead of them, so
+// everything is drawn on the calling thread, still in the same order.
+template<class E, class Store>
+void parallel_fill(E &engine, uint32_t count, uint32_t threads, uint32_t chunk, Store store)
+{
+	uint32_t chunks = count / chunk + (count % chunk != 0);
+	if (threads > chunks) {
+		threads = chunks;
+	}
+#if !defined(__EMSCRIPTEN__)
+	if (threads > 1 && !engine.prefetched()) {
+		std::atomic<uint32_t> next(0);
+#if RNG_FINGERPRINT
+		std::vector<RngFingerprint> prints(chunks);
+#endif
+		auto work = [&]() {
+			for (;;) {
+				uint32_t k = next.fetch_add(1);
+				if (k >= chunks) {
+					return;
+				}
+				uint64_t first = (uint64_t)k * chunk;
+				E lane = engine;
+				lane.advance(first);
+#if RNG_FINGERPRINT
+				lane.fingerprint_reset();
+#endif
+				store(lane, (uint32_t)first, count - first < chunk ? (uint32_t)(count - first) : chunk);
+#if RNG_FINGERPRINT
+				prints[k] = lane.fingerprint();
+#endif
+			}
+		};
+		std::vector<std::thread> pool;
+		for (uint32_t t = 1; t < threads; t++) {
+			pool.push_back(std::thread(work));
+		}
+		work();
+		for (size_t t = 0; t < pool.size(); t++) {
+			pool[t].join();
+		}
+		engine.advance(count);
+#if RNG_STATS
+		engine.stats_add_draws(count);
+#endif
+#if RNG_FINGERPRINT
+		for (uint32_t k = 0; k < chunks; k++) {
+			engine.fingerprint_append(prints[k]);
+		}
+#endif
+		return;
+	}
+#endif
+	for (uint64_t first = 0; first < count; first += chunk) {
+		store(engine, (uint32_t)first, count - first < chunk ? (uint32_t)(count - first) : chunk);
+	}
+}
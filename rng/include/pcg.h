@@ -1,9 +1,12 @@
 #pragma once
 
+#include "engine.hpp"
+#include "entropy.h"
+
 #include <math.h>
 #include <stdio.h>
 
-class Pcg32
+class Pcg32 : public Engine<Pcg32>
 {
 	private:
 	pcg32_random_t state;
@@ -17,33 +20,44 @@ class Pcg32
 		pcg32_srandom_r(&state, stat, inc);
 	}
 
-	uint32_t number() {
-		return pcg32_random_r(&state);
+	void set_random_seed() {
+		uint64_t seeds[2] = {0, 0};
+		entropy_getbytes((void *)seeds, sizeof(seeds));
+		set_seed(seeds[0], seeds[1]);
 	}
 
-	uint32_t range(uint32_t min, uint32_t max) {
-		max++;
-		return pcg32_boundedrand_r(&state, (max - min)) + min;
+	// pcg32_random_r, inlined: called through pcg_basic.c the state went
+	// through memory on every value, and fill lost to a loop of number()
+	uint32_t step() {
+		uint64_t old = state.state;
+		state.state = old * 6364136223846793005ULL + state.inc;
+		uint32_t xorshifted = (uint32_t)(((old >> 18u) ^ old) >> 27u);
+		uint32_t rot = (uint32_t)(old >> 59u);
+		return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
 	}
 
-	double double_range(uint32_t min, uint32_t max) {
-		uint32_t num = pcg32_random_r(&state);
-		return (double)(num) / ((double)UINT32_MAX) * (max - min) + min;
+	// the C state, for rng_api.h
+	pcg32_random_t *native_state() {
+		return &state;
 	}
-	
-	double double_num() {
-		return ldexp(pcg32_random_r(&state), -32);
+
+	// skips delta numbers, in O(log delta)
+	void advance(uint64_t delta) {
+		pcg32_advance_r(&state, delta);
 	}
 
-	int roll() {
-		return pcg32_boundedrand_r(&state, 6);
+	// legacy mapping, kept so existing seeds give the same values: divides by
+	// 2^32 - 1, so max itself can come out, where Engine::double_range of the
+	// other engines divides by 2^32 and stays below max. Pinned by the
+	// pcg32 double_range(0,1) golden vector (native/golden.cpp)
+	double double_range(double min, double max) {
+		uint32_t num = number();
+		return (double)(num) / ((double)UINT32_MAX) * (max - min) + min;
 	}
 
-	int toss() {
-		return pcg32_boundedrand_r(&state, 2);
+	// legacy: 0 to 5, kept so existing seeds give the same values
+	// (range uses the same rejection as pcg32_boundedrand_r)
+	int roll() {
+		return range(0, 5);
 	}
-		
-	void Release() {
-		//release code goes here
-	}    
 };
@@ -73,6 +73,14 @@ uint32_t pcg32_random_r(pcg32_random_t* rng);
 uint32_t pcg32_boundedrand(uint32_t bound);
 uint32_t pcg32_boundedrand_r(pcg32_random_t* rng, uint32_t bound);
 
+// pcg32_advance_r(rng, delta):
+//     Multi-step advance function (jump-ahead, jump-back), in O(log delta)
+//     time: same as the pcg32_advance_r of pcg_variants.h, for this struct
+
+void pcg32_advance_r(pcg32_random_t* rng, uint64_t delta);
+uint64_t pcg_advance_lcg_64(uint64_t state, uint64_t delta, uint64_t cur_mult,
+                            uint64_t cur_plus);
+
 #if __cplusplus
 }
 #endif
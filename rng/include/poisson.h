@@ -0,0 +1,71 @@
+#ifndef POISSON_H
+#define POISSON_H
+/**
+ * @file poisson.h
+ *
+ * @brief Poisson-disk sampling with Bridson's algorithm
+ *
+ * Robert Bridson, "Fast Poisson Disk Sampling in Arbitrary Dimensions"
+ * (SIGGRAPH 2007). A background grid with cells of radius / sqrt(2) holds at
+ * most one point each, so every candidate is checked against a constant
+ * number of neighbours and the whole set is built in O(n).
+ *
+ * The random numbers come from a caller supplied function, so any generator
+ * of this extension can drive it and the point set only depends on its seed.
+ */
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * largest background grid, in cells (one point at most per cell): 16 bytes
+ * per cell are needed, 256 MB at most
+ */
+#define POISSON_MAX_CELLS (1u << 24)
+
+typedef uint32_t (*poisson_next_fn)(void * ctx);
+
+/**
+ * poisson-disk parameters. With a density map, the minimum distance at a
+ * point goes from max_radius (density 0) down to radius (density 1).
+ */
+struct POISSON_T {
+    float width;
+    float height;
+    float radius;
+    int k;
+    const float * density;
+    uint32_t density_width;
+    uint32_t density_height;
+    uint32_t density_stride;
+    float max_radius;
+};
+
+typedef struct POISSON_T poisson_t;
+
+void poisson_init(poisson_t * poisson, float width, float height, float radius);
+
+/**
+ * @return the maximum number of points poisson_disk can produce, which is
+ * also the number of cells of its grid: poisson_disk fails above
+ * POISSON_MAX_CELLS
+ */
+uint64_t poisson_capacity(const poisson_t * poisson);
+
+/**
+ * Fills out with x, y pairs.
+ * @param out room for 2 * poisson_capacity() floats
+ * @return number of points, or -1 if the grid has more than
+ * POISSON_MAX_CELLS cells or memory could not be allocated
+ */
+int poisson_disk(const poisson_t * poisson, poisson_next_fn next, void * ctx,
+                 float * out);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
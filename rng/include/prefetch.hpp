@@ -0,0 +1,261 @@
+#pragma once
+
+#include <stdint.h>
+
+// Background prefetching (gen:prefetch): a native worker thread keeps a ring
+// of raw engine outputs full, and the engine pops from the ring instead of
+// stepping its state.
+//
+// A ring is lock free, single producer (the worker) and single consumer (the
+// thread using the generator). Only the holder of the ring's busy flag steps
+// the engine: the worker while it refills a chunk, or the consumer on
+// underflow, once it has popped everything the worker pushed. So values
+// always come out in the order the engine produces them, with or without a
+// ring.
+//
+// Rings are not stored in the engines, which keep only their state: a table
+// keyed by the engine's address holds them. Draws only look an engine up on
+// a thread which called prefetch() while rings are left, so a prefetching
+// engine must be drawn from that thread. Elsewhere a draw only reads a
+// thread local flag, which the compiler keeps out of loops; an atomic read
+// there kept the state of multi-word engines out of registers (2 to 4 times
+// slower loops).
+//
+// HTML5 has no threads: there RNG_PREFETCH is 0 and engines never prefetch.
+#if defined(__EMSCRIPTEN__)
+#define RNG_PREFETCH 0
+#else
+#define RNG_PREFETCH 1
+#endif
+
+// ring capacities, in values
+#define PREFETCH_DEFAULT_CAPACITY 4096
+#define PREFETCH_MIN_CAPACITY 64
+#define PREFETCH_MAX_CAPACITY (1u << 20)
+
+// values a refill steps per hold of the ring's busy flag
+#define PREFETCH_CHUNK 64
+
+// engines prefetching at once, and slots of the table of their rings (a
+// power of 2, twice as many, for short probes)
+#define PREFETCH_MAX_RINGS 256
+#define PREFETCH_TABLE_SIZE 512
+
+#if RNG_PREFETCH
+
+#include <atomic>
+
+// what the worker sees of a ring
+class PrefetchRing
+{
+	public:
+	virtual ~PrefetchRing() {}
+
+	// steps the engine until the ring is full, unless the consumer holds it
+	virtual void refill() = 0;
+};
+
+// a slot of the table: engine is 0 if never used, PREFETCH_REMOVED once freed
+struct PrefetchSlot {
+	std::atomic<const void*> engine;
+	std::atomic<PrefetchRing*> ring;
+};
+
+struct PrefetchTable {
+	std::atomic<uint32_t> rings;  // rings in the table
+	PrefetchSlot slots[PREFETCH_TABLE_SIZE];
+};
+
+#define PREFETCH_REMOVED ((const void*)1)
+
+extern PrefetchTable prefetch_table;
+
+// whether the calling thread may draw from an engine with a ring: set by
+// prefetch_insert, cleared by the thread itself once no ring is left
+inline bool &prefetch_thread_rings() {
+	static thread_local bool rings = false;
+	return rings;
+}
+
+inline bool prefetch_any() {
+	return prefetch_thread_rings();
+}
+
+inline uint32_t prefetch_slot(const void *engine) {
+	uint64_t key = (uint64_t)(uintptr_t)engine * 0x9e3779b97f4a7c15ull;
+	return (uint32_t)(key >> 32) & (PREFETCH_TABLE_SIZE - 1);
+}
+
+// the ring of engine, or 0. Lock free: slots are only written under a lock,
+// a used slot is never emptied while rings are left, and an engine's slot
+// only changes on the thread using the engine
+inline PrefetchRing *prefetch_find(const void *engine) {
+	uint32_t i = prefetch_slot(engine);
+	for (uint32_t n = 0; n < PREFETCH_TABLE_SIZE; n++) {
+		const void *key = prefetch_table.slots[i].engine.load(std::memory_order_acquire);
+		if (key == engine) {
+			return prefetch_table.slots[i].ring.load(std::memory_order_relaxed);
+		}
+		if (key == 0) {
+			break;
+		}
+		i = (i + 1) & (PREFETCH_TABLE_SIZE - 1);
+	}
+	if (prefetch_table.rings.load(std::memory_order_relaxed) == 0) {
+		prefetch_thread_rings() = false;
+	}
+	return 0;
+}
+
+// sets the ring of engine, replacing its previous one, to be drawn from the
+// calling thread; false when PREFETCH_MAX_RINGS engines already have one
+bool prefetch_insert(const void *engine, PrefetchRing *ring);
+
+// forgets the ring of engine (it is not deleted)
+void prefetch_remove(const void *engine);
+
+// starts refilling ring in the background, starting the worker if needed
+void prefetch_attach(PrefetchRing *ring);
+
+// stops refilling ring: the worker no longer touches it on return
+void prefetch_detach(PrefetchRing *ring);
+
+// asks the worker for a refill pass over all rings
+void prefetch_wake();
+
+// stops the worker thread (extension finalization)
+void prefetch_shutdown();
+
+template<class E, class Raw>
+class EngineRing : public PrefetchRing
+{
+	E *engine;
+	Raw *values;
+	uint32_t mask;
+	bool attached;
+	std::atomic<uint32_t> head;  // next value to pop, written by the consumer
+	uint32_t tail_seen;          // tail as last read by the consumer
+	char pad[64];                // head and tail on their own cache lines
+	std::atomic<uint32_t> tail;  // next value to push, written by the worker
+	std::atomic_flag busy;       // held while stepping the engine
+
+	void lock() {
+		while (busy.test_and_set(std::memory_order_acquire)) {
+		}
+	}
+
+	void unlock() {
+		busy.clear(std::memory_order_release);
+	}
+
+	public:
+	EngineRing(E *engine, uint32_t capacity):
+		engine(engine), values(new Raw[capacity]), mask(capacity - 1), attached(false), head(0), tail_seen(0), tail(0) {
+		busy.clear();
+	}
+
+	~EngineRing() {
+		if (attached) {
+			prefetch_detach(this);
+		}
+		delete[] values;
+	}
+
+	uint32_t capacity() const { return mask + 1; }
+
+	bool is_attached() const { return attached; }
+
+	void attach() {
+		attached = true;
+		prefetch_attach(this);
+	}
+
+	// the remaining values are still popped, then the consumer steps the
+	// engine itself
+	void detach() {
+		prefetch_detach(this);
+		attached = false;
+	}
+
+	// values left to pop
+	uint32_t size() const {
+		return tail.load(std::memory_order_acquire) - head.load(std::memory_order_relaxed);
+	}
+
+	// moves the values left in other (detached) into this ring (not yet
+	// attached, large enough), in order
+	void take(EngineRing &other) {
+		Raw value;
+		uint32_t t = tail.load(std::memory_order_relaxed);
+		while (other.pop(value)) {
+			values[t & mask] = value;
+			t++;
+		}
+		tail.store(t, std::memory_order_release);
+	}
+
+	// consumer side, false when empty; tail is only read again once the
+	// values seen so far are used up, so the worker's cache line is left alone
+	bool pop(Raw &value) {
+		uint32_t h = head.load(std::memory_order_relaxed);
+		if (h == tail_seen) {
+			tail_seen = tail.load(std::memory_order_acquire);
+			if (h == tail_seen) {
+				return false;
+			}
+		}
+		value = values[h & mask];
+		head.store(h + 1, std::memory_order_release);
+		if (tail_seen - h - 1 == (mask + 1) / 2 && attached) {
+			prefetch_wake();  // half empty, as far as we know
+		}
+		return true;
+	}
+
+	// consumer side, on underflow: pops what the worker publishes while it
+	// holds the flag, and steps the engine only once the flag is free and
+	// the ring is still empty
+	Raw underflow() {
+		Raw value;
+		for (;;) {
+			if (pop(value)) {
+				break;
+			}
+			if (!busy.test_and_set(std::memory_order_acquire)) {
+				if (!pop(value)) {
+					value = engine->step();
+				}
+				unlock();
+				break;
+			}
+		}
+		if (attached) {
+			prefetch_wake();
+		}
+		return value;
+	}
+
+	// steps the engine PREFETCH_CHUNK values at a time, publishing and
+	// releasing the flag after each chunk, so an underflowing consumer
+	// waits for one chunk at most
+	void refill() {
+		for (;;) {
+			if (busy.test_and_set(std::memory_order_acquire)) {
+				return;  // the consumer is stepping, it wakes us up after
+			}
+			uint32_t t = tail.load(std::memory_order_relaxed);
+			uint32_t room = head.load(std::memory_order_acquire) + capacity() - t;
+			uint32_t n = room < PREFETCH_CHUNK ? room : PREFETCH_CHUNK;
+			for (uint32_t i = 0; i < n; i++) {
+				values[(t + i) & mask] = engine->step();
+			}
+			tail.store(t + n, std::memory_order_release);
+			unlock();
+			if (n == room) {
+				return;
+			}
+		}
+	}
+};
+
+#endif
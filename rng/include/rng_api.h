@@ -0,0 +1,88 @@
+#ifndef RNG_API_H
+#define RNG_API_H
+/**
+ * @file rng_api.h
+ *
+ * @brief Native API of the generators, for other extensions
+ *
+ * Gives native code the generators Lua scripts create, so a pathfinding or
+ * particle extension draws the same deterministic values without calling
+ * back into Lua for each one. Pointers stay valid as long as the Lua value
+ * is alive (userdata never move), and like the Lua methods they are not
+ * thread safe: use rng.shared (shared.hpp) to draw from several threads.
+ *
+ * C++ gets the engine classes (engines.hpp), all inline:
+ *
+ *   Pcg32 *gen = rng_to_engine<Pcg32>(L, 1);
+ *   if (gen) gen->range(1, 6);  // same values as gen:range(1, 6) in Lua
+ *
+ * C gets the flat functions of rng_ffi.h on rng_to_generator, or the
+ * state struct itself with rng_to_state, to step with the inline
+ * functions of its header (xoshiro128_next, sfc32_next, ...). Stepping
+ * the state directly gives number() for 32 bit engines, and the full 64
+ * bit output (number() is its upper half) for the others.
+ *
+ * Generators are named as in rng.new: pcg32, tinymt32, tinymt64,
+ * xoshiro128, xoshiro256, sfmt19937, chacha8, chacha20, wyrand, sfc32,
+ * sfc64, romuduojr.
+ */
+
+#include <stdint.h>
+
+#include "rng_ffi.h"
+#include "pcg_basic.h"
+#include "tinymt32.h"
+#include "tinymt64.h"
+#include "xoshiro.h"
+#include "sfmt.h"
+#include "chacha.h"
+#include "smallrng.h"
+
+struct lua_State;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * @return name of the generator at index, NULL if it is not a generator
+ */
+const char * rng_engine_name(struct lua_State * L, int index);
+
+/**
+ * @return the generator at index, for the rng_<name>_* functions of
+ * rng_ffi.h, NULL if it is not a generator of that name. While it
+ * prefetches, draw from it on the Lua thread only, as with rng_to_engine
+ */
+void * rng_to_generator(struct lua_State * L, int index, const char * name);
+
+/**
+ * @return the state struct (pcg32_random_t, tinymt32_t, ...) of the
+ * generator at index, NULL if it is not a generator of that name, or
+ * while it prefetches (gen:prefetch): the worker thread steps the state
+ * then, and values come from the ring first
+ */
+void * rng_to_state(struct lua_State * L, int index, const char * name);
+
+#if defined(__cplusplus)
+}
+
+#include "engines.hpp"
+#include "shared.hpp"
+
+/**
+ * @return the engine of the generator at index, NULL if it is not a
+ * generator of type E. While it prefetches (gen:prefetch), draw from it
+ * on the Lua thread only: other threads do not see its ring
+ */
+template<class E>
+E * rng_to_engine(struct lua_State * L, int index);
+
+#define RNG_API_DECLARE(type, name) \
+    template<> type * rng_to_engine<type>(struct lua_State * L, int index);
+RNG_ENGINES(RNG_API_DECLARE)
+#undef RNG_API_DECLARE
+
+#endif
+
+#endif
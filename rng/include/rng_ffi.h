@@ -0,0 +1,59 @@
+#ifndef RNG_FFI_H
+#define RNG_FFI_H
+/**
+ * @file rng_ffi.h
+ *
+ * @brief Flat C ABI of the generators, for the LuaJIT FFI (rng/ffi.lua)
+ *
+ * Every generator <name> (pcg32, tinymt32, ... as in rng.new) exports:
+ *
+ *   uint32_t rng_<name>_next(void *gen);
+ *   double   rng_<name>_double(void *gen);
+ *   uint32_t rng_<name>_range(void *gen, uint32_t min, uint32_t max);
+ *   double   rng_<name>_double_range(void *gen, double min, double max);
+ *   int      rng_<name>_roll(void *gen);
+ *   int      rng_<name>_toss(void *gen);
+ *   void     rng_<name>_fill_u32(void *gen, uint32_t *out, uint32_t n);
+ *
+ * gen is the payload of a generator userdata, which is what LuaJIT passes
+ * for a userdata argument of type void *. The functions give the same
+ * values as the Lua methods, but check nothing: gen must be a generator
+ * of that type, and range needs min < max.
+ *
+ * rng.ffi_api() returns the same functions as light userdata, so they can
+ * be used with ffi.cast even where the executable does not export them.
+ */
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#define RNG_FFI_DECLARE(name) \
+    uint32_t rng_##name##_next(void *gen); \
+    double rng_##name##_double(void *gen); \
+    uint32_t rng_##name##_range(void *gen, uint32_t min, uint32_t max); \
+    double rng_##name##_double_range(void *gen, double min, double max); \
+    int rng_##name##_roll(void *gen); \
+    int rng_##name##_toss(void *gen); \
+    void rng_##name##_fill_u32(void *gen, uint32_t *out, uint32_t n);
+
+RNG_FFI_DECLARE(pcg32)
+RNG_FFI_DECLARE(tinymt32)
+RNG_FFI_DECLARE(tinymt64)
+RNG_FFI_DECLARE(xoshiro128)
+RNG_FFI_DECLARE(xoshiro256)
+RNG_FFI_DECLARE(sfmt19937)
+RNG_FFI_DECLARE(chacha8)
+RNG_FFI_DECLARE(chacha20)
+RNG_FFI_DECLARE(wyrand)
+RNG_FFI_DECLARE(sfc32)
+RNG_FFI_DECLARE(sfc64)
+RNG_FFI_DECLARE(romuduojr)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef SEQUENCE_H
+#define SEQUENCE_H
+/**
+ * @file sequence.h
+ *
+ * @brief Low-discrepancy (quasi-random) sequences: Sobol, Halton and R_d
+ *
+ * Points are computed directly from their index, so any point can be
+ * accessed in O(1) (O(log index) digit loops at most) and batches can
+ * start anywhere.
+ *
+ * Randomization keeps the even coverage while decorrelating instances:
+ * Sobol uses hash based Owen scrambling (Burley, "Practical Hash-based
+ * Owen Scrambling", JCGT 2020), Halton and R_d use Cranley-Patterson
+ * rotations (a random toroidal shift per dimension).
+ */
+
+#include <stdint.h>
+
+#define SEQUENCE_SOBOL 0
+#define SEQUENCE_HALTON 1
+#define SEQUENCE_R2 2
+
+#define SEQUENCE_MAX_DIMS 4
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * sequence state: direction numbers (Sobol) and per dimension scrambling
+ * seeds or shifts, as 32 bit fractions
+ */
+struct SEQUENCE_T {
+    int type;
+    int dims;
+    int scrambled;
+    uint32_t direction[SEQUENCE_MAX_DIMS][32];
+    uint32_t seed[SEQUENCE_MAX_DIMS];
+};
+
+typedef struct SEQUENCE_T sequence_t;
+
+/**
+ * @param seeds one seed per dimension, or NULL for the plain sequence
+ */
+void sequence_init(sequence_t * sequence, int type, int dims,
+                   const uint32_t seeds[SEQUENCE_MAX_DIMS]);
+
+/**
+ * Computes point index of the sequence.
+ * @param out receives dims values in [0, 1)
+ */
+void sequence_sample(const sequence_t * sequence, uint32_t index, double * out);
+
+/**
+ * Writes points start .. start + count - 1, point i at out[i * stride],
+ * one dimension per consecutive float. Values are in [0, 1) as floats
+ * too: those that would round up to 1.0f are written as the float below.
+ */
+void sequence_fill(const sequence_t * sequence, uint32_t start, uint32_t count,
+                   float * out, uint32_t stride);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef SFMT_H
+#define SFMT_H
+/**
+ * @file sfmt.h
+ *
+ * @brief SIMD-oriented Fast Mersenne Twister (SFMT19937)
+ *
+ * @author Mutsuo Saito (Hiroshima University)
+ * @author Makoto Matsumoto (Hiroshima University)
+ *
+ * Copyright (C) 2006, 2007 Mutsuo Saito, Makoto Matsumoto and Hiroshima
+ * University.
+ * Copyright (C) 2012 Mutsuo Saito, Makoto Matsumoto, Hiroshima
+ * University and The University of Tokyo.
+ * All rights reserved.
+ *
+ * The 3-clause BSD License is applied to this software.
+ *
+ * The whole 19937 bit state (156 128-bit words) is regenerated at once,
+ * with SSE2 or NEON when available, and 32 bit values are then served from
+ * it. Unlike TinyMT32, the state is ~2.5KB, so prefer it for bulk output.
+ */
+
+#include <stdint.h>
+
+#define SFMT_MEXP 19937
+#define SFMT_N (SFMT_MEXP / 128 + 1)
+#define SFMT_N32 (SFMT_N * 4)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/** 128-bit word, only 4 byte aligned (vector code uses unaligned access) */
+struct SFMT_W128_T {
+    uint32_t u[4];
+};
+
+typedef struct SFMT_W128_T sfmt_w128_t;
+
+/**
+ * SFMT internal state
+ */
+struct SFMT_T {
+    sfmt_w128_t state[SFMT_N];
+    int idx;
+};
+
+typedef struct SFMT_T sfmt_t;
+
+void sfmt_init_gen_rand(sfmt_t * sfmt, uint32_t seed);
+void sfmt_init_by_array(sfmt_t * sfmt, uint32_t * init_key, int key_length);
+void sfmt_gen_rand_all(sfmt_t * sfmt);
+
+/**
+ * Generates size values straight into array, continuing the sequence.
+ * Must be called right after a block was used up (idx == SFMT_N32), size
+ * must be a multiple of 4 and at least SFMT_N32.
+ */
+void sfmt_fill_array32(sfmt_t * sfmt, uint32_t * array, int size);
+
+/**
+ * This function outputs a 32-bit unsigned integer from the state array,
+ * regenerating it when all of it was used.
+ * @param sfmt SFMT internal state
+ * @return 32-bit unsigned pseudorandom number
+ */
+inline static uint32_t sfmt_genrand_uint32(sfmt_t * sfmt) {
+    if (sfmt->idx >= SFMT_N32) {
+        sfmt_gen_rand_all(sfmt);
+        sfmt->idx = 0;
+    }
+    int idx = sfmt->idx++;
+    return sfmt->state[idx / 4].u[idx % 4];
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
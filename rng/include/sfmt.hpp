@@ -0,0 +1,64 @@
+#pragma once
+
+#include "sfmt.h"
+#include "engine.hpp"
+#include "entropy.h"
+
+#include <math.h>
+#include <stdio.h>
+
+class Sfmt19937 : public Engine<Sfmt19937>
+{
+	private:
+	sfmt_t state;
+
+	public:
+	Sfmt19937() { set_seed(0); };
+
+	~Sfmt19937() { Release(); }
+
+	void set_seed(uint32_t seed) {
+		sfmt_init_gen_rand(&state, seed);
+	}
+
+	// the whole state from 4 random values
+	void set_random_seed() {
+		uint32_t key[4];
+		entropy_getbytes((void *)key, sizeof(key));
+		sfmt_init_by_array(&state, key, 4);
+	}
+
+	uint32_t step() {
+		return sfmt_genrand_uint32(&state);
+	}
+
+	// the C state, for rng_api.h
+	sfmt_t *native_state() {
+		return &state;
+	}
+
+	// writes the next count numbers, same sequence as calling number()
+	// count times; whole blocks are generated straight into out
+	void fill(uint32_t *out, uint32_t count) {
+		if (prefetched()) {
+			Engine<Sfmt19937>::fill(out, count);  // the ring comes first
+			return;
+		}
+		while (count > 0 && state.idx < SFMT_N32) {
+			*out++ = number();
+			count--;
+		}
+		if (count >= SFMT_N32) {
+			uint32_t bulk = count & ~3u;
+			sfmt_fill_array32(&state, out, bulk);
+			count_draws(bulk);
+			fingerprint_add(out, bulk);
+			out += bulk;
+			count -= bulk;
+		}
+		while (count > 0) {
+			*out++ = number();
+			count--;
+		}
+	}
+};
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "engines.hpp"
+
+// Shared generators (rng.shared): one generator for the whole game, drawn
+// from any thread. Each thread gets its own lane, an engine of its own,
+// created on its first draw and then found again without any lock, so
+// threads neither contend nor race on a state.
+//
+// Lanes are independent streams of the same seed: another PCG32 stream
+// (increment), xoshiro jumps, another ChaCha nonce, another TinyMT32
+// parameter set, or a seed mixed with the lane index for the others. Lane 0
+// is the generator of the seed with stream 0 (PCG32 increment, ChaCha
+// nonce, TinyMT32 parameter set), so a shared generator first drawn from
+// Lua gives the values of rng.new(name, seed, 0) there (pcg32 needs the
+// 0: rng.new("pcg32", seed) has no default increment). Lanes are
+// numbered in the order threads first draw, so values on worker threads
+// are only reproducible if they start in a fixed order.
+//
+// From C++, knowing the engine:
+//
+//	SharedRng<Pcg32> *shared = new SharedRng<Pcg32>(seed);
+//	shared->lane().range(1, 6);  // inlined, on the calling thread's lane
+//
+// or through SharedGenerator (virtual calls) for one made by Lua, see
+// rng_to_shared. The shared generator must outlive every draw from it.
+
+// what any shared generator provides, whatever its engine
+class SharedGenerator
+{
+	public:
+	virtual ~SharedGenerator() {}
+
+	// engine name, as in rng.new
+	virtual const char *name() const = 0;
+
+	// lanes created so far
+	virtual uint32_t lanes() = 0;
+
+	// draws on the calling thread's lane
+	virtual uint32_t number() = 0;
+	virtual uint32_t range(uint32_t min, uint32_t max) = 0;
+	virtual double double_num() = 0;
+	virtual double double_range(double min, double max) = 0;
+	virtual int roll() = 0;
+	virtual int toss() = 0;
+	virtual void fill(uint32_t *out, uint32_t count) = 0;
+};
+
+// a lane known to a thread: the shared generator's id, never reused, so a
+// destroyed generator's lanes are never found again, and its liveness, so
+// the thread can drop them
+struct SharedLaneRef {
+	uint64_t id;
+	void *lane;
+	std::shared_ptr<const std::atomic<bool> > alive;
+};
+
+// the lanes of the calling thread, for all shared generators
+inline std::vector<SharedLaneRef> &shared_thread_lanes() {
+	static thread_local std::vector<SharedLaneRef> lanes;
+	return lanes;
+}
+
+// drops the calling thread's lanes of destroyed generators
+inline void shared_prune_lanes() {
+	std::vector<SharedLaneRef> &refs = shared_thread_lanes();
+	size_t kept = 0;
+	for (size_t i = 0; i < refs.size(); i++) {
+		if (refs[i].alive->load(std::memory_order_relaxed)) {
+			if (kept != i) {
+				refs[kept] = refs[i];
+			}
+			kept++;
+		}
+	}
+	refs.resize(kept);
+}
+
+inline uint64_t shared_next_id() {
+	static std::atomic<uint64_t> next(1);
+	return next.fetch_add(1);
+}
+
+// creates lane index of seed; engines with cheap independent streams
+// specialize it
+template<class E>
+inline E *shared_new_lane(uint64_t seed, uint32_t index) {
+	E *lane = new E();
+	if (index == 0) {
+		lane->set_seed(seed);
+	} else {
+		uint64_t mixed = splitmix64_next(&seed) + index;
+		lane->set_seed(splitmix64_next(&mixed));
+	}
+	return lane;
+}
+
+template<>
+inline Pcg32 *shared_new_lane<Pcg32>(uint64_t seed, uint32_t index) {
+	Pcg32 *lane = new Pcg32();
+	lane->set_seed(seed, index);
+	return lane;
+}
+
+template<>
+inline TinyMT32 *shared_new_lane<TinyMT32>(uint64_t seed, uint32_t index) {
+	TinyMT32 *lane = new TinyMT32(index % TINYMT32_PARAM_COUNT);
+	if (index < TINYMT32_PARAM_COUNT) {
+		lane->set_seed(seed);
+	} else {
+		uint64_t mixed = splitmix64_next(&seed) + index;
+		lane->set_seed(splitmix64_next(&mixed));
+	}
+	return lane;
+}
+
+template<>
+inline Xoshiro128 *shared_new_lane<Xoshiro128>(uint64_t seed, uint32_t index) {
+	Xoshiro128 *lane = new Xoshiro128();
+	lane->set_seed(seed);
+	for (uint32_t i = 0; i < index; i++) {
+		lane->jump();
+	}
+	return lane;
+}
+
+template<>
+inline Xoshiro256 *shared_new_lane<Xoshiro256>(uint64_t seed, uint32_t index) {
+	Xoshiro256 *lane = new Xoshiro256();
+	lane->set_seed(seed);
+	for (uint32_t i = 0; i < index; i++) {
+		lane->jump();
+	}
+	return lane;
+}
+
+template<>
+inline ChaCha8 *shared_new_lane<ChaCha8>(uint64_t seed, uint32_t index) {
+	ChaCha8 *lane = new ChaCha8();
+	lane->set_seed(seed, index);
+	return lane;
+}
+
+template<>
+inline ChaCha20 *shared_new_lane<ChaCha20>(uint64_t seed, uint32_t index) {
+	ChaCha20 *lane = new ChaCha20();
+	lane->set_seed(seed, index);
+	return lane;
+}
+
+template<class E>
+class SharedRng : public SharedGenerator
+{
+	const char *engine_name;
+	uint64_t id;
+	uint64_t seed;
+	std::mutex lock;  // only taken to create a lane
+	std::vector<E*> all_lanes;
+	std::shared_ptr<std::atomic<bool> > alive;
+
+	E &new_lane() {
+		E *lane;
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			lane = shared_new_lane<E>(seed, (uint32_t)all_lanes.size());
+			all_lanes.push_back(lane);
+		}
+		shared_prune_lanes();
+		SharedLaneRef ref = { id, lane, alive };
+		shared_thread_lanes().push_back(ref);
+		return *lane;
+	}
+
+	public:
+	SharedRng(uint64_t seed, const char *name = ""):
+		engine_name(name), id(shared_next_id()), seed(seed), alive(std::make_shared<std::atomic<bool> >(true)) {}
+
+	// the destroying thread drops its lanes now, other threads when they
+	// next create one
+	~SharedRng() {
+		alive->store(false, std::memory_order_relaxed);
+		shared_prune_lanes();
+		for (size_t i = 0; i < all_lanes.size(); i++) {
+			delete all_lanes[i];
+		}
+	}
+
+	// the calling thread's lane, created on its first call
+	E &lane() {
+		std::vector<SharedLaneRef> &refs = shared_thread_lanes();
+		for (size_t i = 0; i < refs.size(); i++) {
+			if (refs[i].id == id) {
+				return *static_cast<E*>(refs[i].lane);
+			}
+		}
+		return new_lane();
+	}
+
+	const char *name() const { return engine_name; }
+
+	uint32_t lanes() {
+		std::lock_guard<std::mutex> guard(lock);
+		return (uint32_t)all_lanes.size();
+	}
+
+	uint32_t number() { return lane().number(); }
+	uint32_t range(uint32_t min, uint32_t max) { return lane().range(min, max); }
+	double double_num() { return lane().double_num(); }
+	double double_range(double min, double max) { return lane().double_range(min, max); }
+	int roll() { return lane().roll(); }
+	int toss() { return lane().toss(); }
+	void fill(uint32_t *out, uint32_t count) { lane().fill(out, count); }
+};
+
+// the shared generator of a Lua value made by rng.shared, or 0: native
+// extensions can draw from it on any thread, as long as the Lua value is
+// kept alive
+struct lua_State;
+SharedGenerator *rng_to_shared(lua_State *L, int index);
@@ -0,0 +1,127 @@
+#ifndef SMALLRNG_H
+#define SMALLRNG_H
+/**
+ * @file smallrng.h
+ *
+ * @brief Small state, very fast non-cryptographic generators
+ *
+ * - wyrand (Wang Yi, wyhash final version 4): 8 byte state, a counter
+ *   mixed with a 64x64->128 bit multiply
+ * - SFC32 / SFC64 (Chris Doty-Humphrey, PractRand): 16 / 32 byte state,
+ *   chaotic with a counter, so the minimum period is 2^32 / 2^64
+ * - RomuDuoJr (Mark Overton, "Romu: Fast Nonlinear Pseudo-Random Number
+ *   Generators Providing High Quality", 2020): 16 byte state, one multiply
+ *   per step
+ *
+ * Meant for many instances (one per entity), where state size matters.
+ */
+
+#include <stdint.h>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+struct WYRAND_T {
+    uint64_t state;
+};
+
+struct SFC32_T {
+    uint32_t a, b, c, counter;
+};
+
+struct SFC64_T {
+    uint64_t a, b, c, counter;
+};
+
+struct ROMUDUOJR_T {
+    uint64_t x, y;
+};
+
+typedef struct WYRAND_T wyrand_t;
+typedef struct SFC32_T sfc32_t;
+typedef struct SFC64_T sfc64_t;
+typedef struct ROMUDUOJR_T romuduojr_t;
+
+void wyrand_init(wyrand_t * random, uint64_t seed);
+void sfc32_init(sfc32_t * random, uint64_t seed);
+void sfc64_init(sfc64_t * random, uint64_t seed);
+void romuduojr_init(romuduojr_t * random, uint64_t seed);
+
+/**
+ * 64x64->128 bit multiply, returns the low half and stores the high half
+ */
+inline static uint64_t smallrng_mul128(uint64_t a, uint64_t b, uint64_t * hi) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    *hi = (uint64_t)(r >> 64);
+    return (uint64_t)r;
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(a, b, hi);
+#else
+    uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32), c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    *hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    return lo;
+#endif
+}
+
+/**
+ * This function outputs a 64-bit unsigned integer and advances the state.
+ * @param random wyrand state
+ */
+inline static uint64_t wyrand_next(wyrand_t * random) {
+    uint64_t hi, lo;
+    random->state += UINT64_C(0x2d358dccaa6c78a5);
+    lo = smallrng_mul128(random->state, random->state ^ UINT64_C(0x8bb84b93962eacc9), &hi);
+    return lo ^ hi;
+}
+
+/**
+ * This function outputs a 32-bit unsigned integer and advances the state.
+ * @param random sfc32 state
+ */
+inline static uint32_t sfc32_next(sfc32_t * random) {
+    uint32_t tmp = random->a + random->b + random->counter++;
+    random->a = random->b ^ (random->b >> 9);
+    random->b = random->c + (random->c << 3);
+    random->c = ((random->c << 21) | (random->c >> 11)) + tmp;
+    return tmp;
+}
+
+/**
+ * This function outputs a 64-bit unsigned integer and advances the state.
+ * @param random sfc64 state
+ */
+inline static uint64_t sfc64_next(sfc64_t * random) {
+    uint64_t tmp = random->a + random->b + random->counter++;
+    random->a = random->b ^ (random->b >> 11);
+    random->b = random->c + (random->c << 3);
+    random->c = ((random->c << 24) | (random->c >> 40)) + tmp;
+    return tmp;
+}
+
+/**
+ * This function outputs a 64-bit unsigned integer and advances the state.
+ * @param random RomuDuoJr state
+ */
+inline static uint64_t romuduojr_next(romuduojr_t * random) {
+    uint64_t xp = random->x;
+    random->x = UINT64_C(15241094284759029579) * random->y;
+    random->y = random->y - xp;
+    random->y = (random->y << 27) | (random->y >> 37);
+    return xp;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
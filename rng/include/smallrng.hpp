@@ -0,0 +1,146 @@
+#pragma once
+
+#include "smallrng.h"
+#include "engine.hpp"
+#include "entropy.h"
+
+#include <math.h>
+#include <stdio.h>
+
+class Wyrand : public Engine<Wyrand, uint64_t>
+{
+	private:
+	wyrand_t state;
+
+	public:
+	Wyrand() { set_seed(0); };
+
+	~Wyrand() { Release(); }
+
+	void set_seed(uint64_t seed) {
+		wyrand_init(&state, seed);
+	}
+
+	void set_random_seed() {
+		uint64_t seed = 0;
+		entropy_getbytes((void *)&seed, sizeof(seed));
+		set_seed(seed);
+	}
+
+	// 64 bit output, number() is its upper half
+	uint64_t step() {
+		return wyrand_next(&state);
+	}
+
+	// the C state, for rng_api.h
+	wyrand_t *native_state() {
+		return &state;
+	}
+
+	// 53 random bits, from a single step
+	double double_num() {
+		return (next() >> 11) * (1.0 / 9007199254740992.0);
+	}
+};
+
+class Sfc32 : public Engine<Sfc32>
+{
+	private:
+	sfc32_t state;
+
+	public:
+	Sfc32() { set_seed(0); };
+
+	~Sfc32() { Release(); }
+
+	void set_seed(uint64_t seed) {
+		sfc32_init(&state, seed);
+	}
+
+	void set_random_seed() {
+		uint64_t seed = 0;
+		entropy_getbytes((void *)&seed, sizeof(seed));
+		set_seed(seed);
+	}
+
+	uint32_t step() {
+		return sfc32_next(&state);
+	}
+
+	// the C state, for rng_api.h
+	sfc32_t *native_state() {
+		return &state;
+	}
+};
+
+class Sfc64 : public Engine<Sfc64, uint64_t>
+{
+	private:
+	sfc64_t state;
+
+	public:
+	Sfc64() { set_seed(0); };
+
+	~Sfc64() { Release(); }
+
+	void set_seed(uint64_t seed) {
+		sfc64_init(&state, seed);
+	}
+
+	void set_random_seed() {
+		uint64_t seed = 0;
+		entropy_getbytes((void *)&seed, sizeof(seed));
+		set_seed(seed);
+	}
+
+	// 64 bit output, number() is its upper half
+	uint64_t step() {
+		return sfc64_next(&state);
+	}
+
+	// the C state, for rng_api.h
+	sfc64_t *native_state() {
+		return &state;
+	}
+
+	// 53 random bits, from a single step
+	double double_num() {
+		return (next() >> 11) * (1.0 / 9007199254740992.0);
+	}
+};
+
+class RomuDuoJr : public Engine<RomuDuoJr, uint64_t>
+{
+	private:
+	romuduojr_t state;
+
+	public:
+	RomuDuoJr() { set_seed(0); };
+
+	~RomuDuoJr() { Release(); }
+
+	void set_seed(uint64_t seed) {
+		romuduojr_init(&state, seed);
+	}
+
+	void set_random_seed() {
+		uint64_t seed = 0;
+		entropy_getbytes((void *)&seed, sizeof(seed));
+		set_seed(seed);
+	}
+
+	// 64 bit output, number() is its upper half
+	uint64_t step() {
+		return romuduojr_next(&state);
+	}
+
+	// the C state, for rng_api.h
+	romuduojr_t *native_state() {
+		return &state;
+	}
+
+	// 53 random bits, from a single step
+	double double_num() {
+		return (next() >> 11) * (1.0 / 9007199254740992.0);
+	}
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>
+
+// Draw statistics (gen:stats, rng.stats): which systems use up how many
+// values. Off by default; build with RNG_STATS=1 (ext.manifest defines) to
+// count, release builds then pay nothing. Counted per engine, and in
+// totals for all engines and threads (relaxed atomics):
+//   draws         values the engine gave (steps, or ring values)
+//   rejections    values range() drew again, in its rejection loop
+//   batches       bulk requests (fill_buffer, fill_parallel, ffi fill)
+//   batch_values  values of those requests
+//   max_batch     largest request
+#ifndef RNG_STATS
+#define RNG_STATS 0
+#endif
+
+#if RNG_STATS
+
+#include <atomic>
+
+struct RngStats {
+	uint64_t draws;
+	uint64_t rejections;
+	uint64_t batches;
+	uint64_t batch_values;
+	uint64_t max_batch;
+
+	RngStats(): draws(0), rejections(0), batches(0), batch_values(0), max_batch(0) {}
+};
+
+struct RngGlobalStats {
+	std::atomic<uint64_t> draws;
+	std::atomic<uint64_t> rejections;
+	std::atomic<uint64_t> batches;
+	std::atomic<uint64_t> batch_values;
+	std::atomic<uint64_t> max_batch;
+
+	RngGlobalStats(): draws(0), rejections(0), batches(0), batch_values(0), max_batch(0) {}
+
+	RngStats load() const {
+		RngStats stats;
+		stats.draws = draws.load(std::memory_order_relaxed);
+		stats.rejections = rejections.load(std::memory_order_relaxed);
+		stats.batches = batches.load(std::memory_order_relaxed);
+		stats.batch_values = batch_values.load(std::memory_order_relaxed);
+		stats.max_batch = max_batch.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	void reset() {
+		draws.store(0, std::memory_order_relaxed);
+		rejections.store(0, std::memory_order_relaxed);
+		batches.store(0, std::memory_order_relaxed);
+		batch_values.store(0, std::memory_order_relaxed);
+		max_batch.store(0, std::memory_order_relaxed);
+	}
+};
+
+inline RngGlobalStats &rng_global_stats() {
+	static RngGlobalStats stats;
+	return stats;
+}
+
+#endif
@@ -1,26 +1,29 @@
 #pragma once
 
 #include "tinymt32.h"
+#include "tinymt32_params.h"
+#include "engine.hpp"
 #include "entropy.h"
 
 #include <math.h>
 #include <stdio.h>
 
-class TinyMT32
+class TinyMT32 : public Engine<TinyMT32>
 {
 	private:
 	tinymt32_t state;
 
-	tinymt32_t initial_state() {
+	tinymt32_t initial_state(int param_id) {
 		tinymt32_t result;
-		result.mat1 = 0x8f7011ee;
-		result.mat2 = 0xfc78ff1f;
-		result.tmat = 0x3793fdff;
+		result.mat1 = tinymt32_params[param_id][0];
+		result.mat2 = tinymt32_params[param_id][1];
+		result.tmat = tinymt32_params[param_id][2];
 		return result;
 	}
 	
 	public:
-	TinyMT32(): state(initial_state()) {};
+	// param_id selects the characteristic polynomial, 0 is the reference one
+	TinyMT32(int param_id = 0): state(initial_state(param_id)) {};
 
 	~TinyMT32() { Release(); }
 
@@ -28,42 +31,32 @@ class TinyMT32
 		tinymt32_init(&state, seed);
 	}
 
-	void set_seed_by_array(uint32_t* seed) {
-		tinymt32_init_by_array(&state, seed, sizeof(seed));
+	// 4 random values from entropy, as the seed array
+	void set_random_seed() {
+		uint32_t seed[4];
+		entropy_getbytes((void *)seed, sizeof(seed));
+		tinymt32_init_by_array(&state, seed, 4);
 	}
 	
-	uint32_t number() {
-		return tinymt32_generate_uint32(&state);
+	// tinymt32_generate_uint32 with a branchless tempering: its branch on
+	// a random bit mispredicts half the time in fill loops
+	uint32_t step() {
+		tinymt32_next_state(&state);
+		uint32_t t0 = state.status[3];
+		uint32_t t1 = state.status[0] + (state.status[2] >> TINYMT32_SH8);
+		return t0 ^ t1 ^ (-(t1 & 1) & state.tmat);
 	}
 
+	// the C state, for rng_api.h
+	tinymt32_t *native_state() {
+		return &state;
+	}
+
+	// legacy scaling of a 32 bit double (tinymt32_generate_32double), kept
+	// so existing seeds give the same values
 	uint32_t range(uint32_t min, uint32_t max) {
-		double r = tinymt32_generate_32double(&state);
+		double r = number() * (1.0 / 4294967296.0);
 		uint32_t d = max - min + 1;
 		return d * r + min;
 	}
-
-	double double_range(uint32_t min, uint32_t max) {
-		double r = tinymt32_generate_32double(&state);
-		uint32_t d = max - min;
-		return r * d + min;
-	}
-
-	double double_num() {
-		return tinymt32_generate_32double(&state);
-	}
-
-	void Release() {
-		//release code goes here
-	}
-
-	static uint32_t* random_seed(int length) {
-		uint64_t* array = new uint64_t[length];
-		entropy_getbytes((void *)array, length);
-		uint32_t* result = new uint32_t[length];
-		for (int i = 0; i < length; i++) {
-			result[i] = (uint32_t)array[i];
-		}
-		
-		return result;
-	}
 };
@@ -0,0 +1,33 @@
+#ifndef TINYMT32_PARAMS_H
+#define TINYMT32_PARAMS_H
+/**
+ * @file tinymt32_params.h
+ *
+ * @brief Precomputed TinyMT32 parameter sets (mat1, mat2, tmat)
+ *
+ * Each set has a different characteristic polynomial, so instances using
+ * different sets produce independent sequences, whatever their seeds.
+ * This avoids jump-ahead when splitting work between threads or entities.
+ *
+ * Set 0 is the reference parameter set of TinyMT32. The others were
+ * searched the same way as tinymt32dc does: the characteristic polynomial
+ * (found with Berlekamp-Massey) is irreducible of degree 127, so the
+ * period is 2^127-1, its weight is between 50 and 78, and tmat gives
+ * optimal equidistribution of the tempered output (delta = 0).
+ */
+
+#include <stdint.h>
+
+#define TINYMT32_PARAM_COUNT 1024
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+extern const uint32_t tinymt32_params[TINYMT32_PARAM_COUNT][3];
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "tinymt64.h"
+#include "engine.hpp"
+#include "entropy.h"
+
+#include <math.h>
+#include <stdio.h>
+
+class TinyMT64 : public Engine<TinyMT64, uint64_t>
+{
+	private:
+	tinymt64_t state;
+
+	tinymt64_t initial_state() {
+		tinymt64_t result;
+		result.mat1 = 0xfa051f40;
+		result.mat2 = 0xffd0fff4;
+		result.tmat = UINT64_C(0x58d02ffeffbfffbc);
+		return result;
+	}
+
+	public:
+	TinyMT64(): state(initial_state()) {};
+
+	~TinyMT64() { Release(); }
+
+	void set_seed(uint64_t seed) {
+		tinymt64_init(&state, seed);
+	}
+
+	void set_random_seed() {
+		uint64_t seed = 0;
+		entropy_getbytes((void *)&seed, sizeof(seed));
+		set_seed(seed);
+	}
+
+	// 64 bit output, number() is its upper half
+	// tinymt64_generate_uint64 with a branchless tempering, as TinyMT32
+	uint64_t step() {
+		tinymt64_next_state(&state);
+		uint64_t x = state.status[0] + state.status[1];
+		x ^= state.status[0] >> TINYMT64_SH8;
+		return x ^ (-(x & 1) & state.tmat);
+	}
+
+	// the C state, for rng_api.h
+	tinymt64_t *native_state() {
+		return &state;
+	}
+
+	// 53 random bits, from a single step (tinymt64_generate_double)
+	double double_num() {
+		return (next() >> 11) * TINYMT64_MUL;
+	}
+};
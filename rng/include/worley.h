@@ -0,0 +1,64 @@
+#ifndef WORLEY_H
+#define WORLEY_H
+/**
+ * @file worley.h
+ *
+ * @brief Worley (cellular) noise with hashed feature points
+ *
+ * Every unit cell holds one feature point. Its position is drawn from a
+ * small PCG stream whose starting state is hashed from the seed and the
+ * cell coordinates, so any cell can be evaluated on its own, in any order,
+ * and always gets the same point.
+ */
+
+#include <stdint.h>
+
+#define WORLEY_EUCLIDEAN 0
+#define WORLEY_MANHATTAN 1
+#define WORLEY_CHEBYSHEV 2
+
+#define WORLEY_F1 0
+#define WORLEY_F2 1
+#define WORLEY_F2_F1 2
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * worley noise parameters
+ */
+struct WORLEY_T {
+    uint32_t seed;
+    int metric;
+    int output;
+    float jitter;
+};
+
+typedef struct WORLEY_T worley_t;
+
+void worley_init(worley_t * worley, uint32_t seed);
+
+/**
+ * Samples the cellular noise at (x, y).
+ * @param worley worley parameters
+ * @param cell if not NULL, receives a value in [0, 1) identifying the
+ * cell of the nearest feature point (useful to assign biomes)
+ * @return F1, F2 or F2 - F1 distance, depending on output
+ */
+float worley_sample2(const worley_t * worley, float x, float y, float * cell);
+
+/**
+ * Fills a w x h grid, row major, with samples taken at
+ * (x0 + i * dx, y0 + j * dy). Value (i, j) is written to
+ * out[(j * w + i) * stride].
+ */
+void worley_fill_grid(const worley_t * worley, float * out, uint32_t stride,
+                      float x0, float y0, float dx, float dy,
+                      uint32_t w, uint32_t h);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
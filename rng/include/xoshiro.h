@@ -0,0 +1,102 @@
+#ifndef XOSHIRO_H
+#define XOSHIRO_H
+/**
+ * @file xoshiro.h
+ *
+ * @brief xoshiro128++ and xoshiro256++ generators
+ *
+ * David Blackman and Sebastiano Vigna, "Scrambled Linear Pseudorandom
+ * Number Generators" (2018), http://prng.di.unimi.it
+ *
+ * xoshiro128++ only uses 32 bit additions, xors, shifts and rotations, so
+ * it is fast on 32 bit CPUs (no 64 bit multiply, unlike PCG32).
+ * xoshiro256++ produces 64 bit outputs, for full precision doubles.
+ * Both provide jump functions to split one seed into non-overlapping
+ * streams.
+ */
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+struct XOSHIRO128_T {
+    uint32_t s[4];
+};
+
+struct XOSHIRO256_T {
+    uint64_t s[4];
+};
+
+typedef struct XOSHIRO128_T xoshiro128_t;
+typedef struct XOSHIRO256_T xoshiro256_t;
+
+/**
+ * This function outputs a 64 bit value of the splitmix64 sequence, used to
+ * expand seeds into full states.
+ * @param x splitmix64 state
+ */
+uint64_t splitmix64_next(uint64_t * x);
+
+void xoshiro128_init(xoshiro128_t * random, uint64_t seed);
+void xoshiro256_init(xoshiro256_t * random, uint64_t seed);
+
+/** advances xoshiro128++ by 2^64 steps (2^64 non-overlapping streams) */
+void xoshiro128_jump(xoshiro128_t * random);
+/** advances xoshiro128++ by 2^96 steps */
+void xoshiro128_long_jump(xoshiro128_t * random);
+/** advances xoshiro256++ by 2^128 steps */
+void xoshiro256_jump(xoshiro256_t * random);
+/** advances xoshiro256++ by 2^192 steps */
+void xoshiro256_long_jump(xoshiro256_t * random);
+
+inline static uint32_t xoshiro_rotl32(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+inline static uint64_t xoshiro_rotl64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * This function outputs a 32-bit unsigned integer and advances the state.
+ * @param random xoshiro128++ state
+ */
+inline static uint32_t xoshiro128_next(xoshiro128_t * random) {
+    uint32_t * s = random->s;
+    const uint32_t result = xoshiro_rotl32(s[0] + s[3], 7) + s[0];
+    const uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = xoshiro_rotl32(s[3], 11);
+    return result;
+}
+
+/**
+ * This function outputs a 64-bit unsigned integer and advances the state.
+ * @param random xoshiro256++ state
+ */
+inline static uint64_t xoshiro256_next(xoshiro256_t * random) {
+    uint64_t * s = random->s;
+    const uint64_t result = xoshiro_rotl64(s[0] + s[3], 23) + s[0];
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = xoshiro_rotl64(s[3], 45);
+    return result;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
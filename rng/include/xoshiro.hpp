@@ -0,0 +1,91 @@
+#pragma once
+
+#include "xoshiro.h"
+#include "engine.hpp"
+#include "entropy.h"
+
+#include <math.h>
+#include <stdio.h>
+
+class Xoshiro128 : public Engine<Xoshiro128>
+{
+	private:
+	xoshiro128_t state;
+
+	public:
+	Xoshiro128() { set_seed(0); };
+
+	~Xoshiro128() { Release(); }
+
+	void set_seed(uint64_t seed) {
+		xoshiro128_init(&state, seed);
+	}
+
+	void set_random_seed() {
+		uint64_t seed = 0;
+		entropy_getbytes((void *)&seed, sizeof(seed));
+		set_seed(seed);
+	}
+
+	void jump() {
+		xoshiro128_jump(&state);
+	}
+
+	void long_jump() {
+		xoshiro128_long_jump(&state);
+	}
+
+	uint32_t step() {
+		return xoshiro128_next(&state);
+	}
+
+	// the C state, for rng_api.h
+	xoshiro128_t *native_state() {
+		return &state;
+	}
+};
+
+class Xoshiro256 : public Engine<Xoshiro256, uint64_t>
+{
+	private:
+	xoshiro256_t state;
+
+	public:
+	Xoshiro256() { set_seed(0); };
+
+	~Xoshiro256() { Release(); }
+
+	void set_seed(uint64_t seed) {
+		xoshiro256_init(&state, seed);
+	}
+
+	void set_random_seed() {
+		uint64_t seed = 0;
+		entropy_getbytes((void *)&seed, sizeof(seed));
+		set_seed(seed);
+	}
+
+	void jump() {
+		xoshiro256_jump(&state);
+	}
+
+	void long_jump() {
+		xoshiro256_long_jump(&state);
+	}
+
+	// 64 bit output, number() is its upper half, which has the best
+	// quality bits
+	uint64_t step() {
+		return xoshiro256_next(&state);
+	}
+
+	// the C state, for rng_api.h
+	xoshiro256_t *native_state() {
+		return &state;
+	}
+
+	// 53 random bits, from a single step
+	double double_num() {
+		return (next() >> 11) * (1.0 / 9007199254740992.0);
+	}
+};
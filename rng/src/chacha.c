@@ -0,0 +1,314 @@
+/**
+ * @file chacha.c
+ *
+ * @brief ChaCha8 / ChaCha20 keystream generation, CHACHA_BLOCKS at a time
+ *
+ * The vector paths keep word i of every block in lane b of vector i, so the
+ * 4 (or 8) blocks are computed side by side with the scalar round
+ * function, then transposed back to block order.
+ */
+#include "chacha.h"
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define CHACHA_SSE2 1
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define CHACHA_AVX2 1
+    #elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        #include <immintrin.h>
+        #define CHACHA_AVX2 1
+        #define CHACHA_AVX2_DISPATCH 1
+    #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define CHACHA_NEON 1
+#endif
+
+static const uint32_t sigma[4] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d) \
+    a += b; d ^= a; d = ROTL32(d, 16); \
+    c += d; b ^= c; b = ROTL32(b, 12); \
+    a += b; d ^= a; d = ROTL32(d, 8); \
+    c += d; b ^= c; b = ROTL32(b, 7);
+
+static void input_block(const chacha_t * random, uint64_t counter, uint32_t in[16]) {
+    memcpy(in, sigma, sizeof(sigma));
+    memcpy(in + 4, random->key, sizeof(random->key));
+    in[12] = (uint32_t)counter;
+    in[13] = (uint32_t)(counter >> 32);
+    in[14] = (uint32_t)random->nonce;
+    in[15] = (uint32_t)(random->nonce >> 32);
+}
+
+#if !defined(CHACHA_SSE2) && !defined(CHACHA_NEON)
+
+static void blocks_scalar(const chacha_t * random, uint64_t counter, uint32_t * out, int blocks) {
+    uint32_t in[16], x[16];
+    for (int b = 0; b < blocks; b++) {
+        input_block(random, counter + b, in);
+        memcpy(x, in, sizeof(x));
+        for (int i = 0; i < random->rounds; i += 2) {
+            QUARTERROUND(x[0], x[4], x[8], x[12])
+            QUARTERROUND(x[1], x[5], x[9], x[13])
+            QUARTERROUND(x[2], x[6], x[10], x[14])
+            QUARTERROUND(x[3], x[7], x[11], x[15])
+            QUARTERROUND(x[0], x[5], x[10], x[15])
+            QUARTERROUND(x[1], x[6], x[11], x[12])
+            QUARTERROUND(x[2], x[7], x[8], x[13])
+            QUARTERROUND(x[3], x[4], x[9], x[14])
+        }
+        for (int i = 0; i < 16; i++) {
+            out[b * 16 + i] = x[i] + in[i];
+        }
+    }
+}
+
+#endif
+
+#if defined(CHACHA_SSE2)
+
+#define SSE_ROTL(v, n) _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - (n)))
+#define SSE_QR(a, b, c, d) \
+    a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = SSE_ROTL(d, 16); \
+    c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = SSE_ROTL(b, 12); \
+    a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = SSE_ROTL(d, 8); \
+    c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = SSE_ROTL(b, 7);
+
+// 4 blocks, starting at counter
+static void blocks4_sse2(const chacha_t * random, uint64_t counter, uint32_t * out) {
+    uint32_t in[16];
+    __m128i x[16], orig[16];
+    input_block(random, counter, in);
+    for (int i = 0; i < 16; i++) {
+        orig[i] = _mm_set1_epi32((int)in[i]);
+    }
+    // per lane counters, with the carry into the high word
+    uint32_t lo[4], hi[4];
+    for (int b = 0; b < 4; b++) {
+        lo[b] = (uint32_t)(counter + b);
+        hi[b] = (uint32_t)((counter + b) >> 32);
+    }
+    orig[12] = _mm_setr_epi32((int)lo[0], (int)lo[1], (int)lo[2], (int)lo[3]);
+    orig[13] = _mm_setr_epi32((int)hi[0], (int)hi[1], (int)hi[2], (int)hi[3]);
+    memcpy(x, orig, sizeof(x));
+
+    for (int i = 0; i < random->rounds; i += 2) {
+        SSE_QR(x[0], x[4], x[8], x[12])
+        SSE_QR(x[1], x[5], x[9], x[13])
+        SSE_QR(x[2], x[6], x[10], x[14])
+        SSE_QR(x[3], x[7], x[11], x[15])
+        SSE_QR(x[0], x[5], x[10], x[15])
+        SSE_QR(x[1], x[6], x[11], x[12])
+        SSE_QR(x[2], x[7], x[8], x[13])
+        SSE_QR(x[3], x[4], x[9], x[14])
+    }
+
+    for (int i = 0; i < 16; i += 4) {
+        __m128i a = _mm_add_epi32(x[i], orig[i]);
+        __m128i b = _mm_add_epi32(x[i + 1], orig[i + 1]);
+        __m128i c = _mm_add_epi32(x[i + 2], orig[i + 2]);
+        __m128i d = _mm_add_epi32(x[i + 3], orig[i + 3]);
+        // 4x4 transpose: lanes (blocks) become rows
+        __m128i ab_lo = _mm_unpacklo_epi32(a, b), ab_hi = _mm_unpackhi_epi32(a, b);
+        __m128i cd_lo = _mm_unpacklo_epi32(c, d), cd_hi = _mm_unpackhi_epi32(c, d);
+        _mm_storeu_si128((__m128i *)(out + 0 * 16 + i), _mm_unpacklo_epi64(ab_lo, cd_lo));
+        _mm_storeu_si128((__m128i *)(out + 1 * 16 + i), _mm_unpackhi_epi64(ab_lo, cd_lo));
+        _mm_storeu_si128((__m128i *)(out + 2 * 16 + i), _mm_unpacklo_epi64(ab_hi, cd_hi));
+        _mm_storeu_si128((__m128i *)(out + 3 * 16 + i), _mm_unpackhi_epi64(ab_hi, cd_hi));
+    }
+}
+
+#endif
+
+#if defined(CHACHA_AVX2)
+
+#if defined(CHACHA_AVX2_DISPATCH)
+    #define CHACHA_AVX2_FN __attribute__((target("avx2")))
+#else
+    #define CHACHA_AVX2_FN
+#endif
+
+#define AVX_ROTL(v, n) _mm256_or_si256(_mm256_slli_epi32(v, n), _mm256_srli_epi32(v, 32 - (n)))
+#define AVX_QR(a, b, c, d) \
+    a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a); d = _mm256_shuffle_epi8(d, rot16); \
+    c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c); b = AVX_ROTL(b, 12); \
+    a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a); d = _mm256_shuffle_epi8(d, rot8); \
+    c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c); b = AVX_ROTL(b, 7);
+
+// 8 blocks, starting at counter
+CHACHA_AVX2_FN
+static void blocks8_avx2(const chacha_t * random, uint64_t counter, uint32_t * out) {
+    const __m256i rot16 = _mm256_setr_epi8(
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    const __m256i rot8 = _mm256_setr_epi8(
+        3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+        3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+    uint32_t in[16];
+    __m256i x[16], orig[16];
+    input_block(random, counter, in);
+    for (int i = 0; i < 16; i++) {
+        orig[i] = _mm256_set1_epi32((int)in[i]);
+    }
+    uint32_t lo[8], hi[8];
+    for (int b = 0; b < 8; b++) {
+        lo[b] = (uint32_t)(counter + b);
+        hi[b] = (uint32_t)((counter + b) >> 32);
+    }
+    orig[12] = _mm256_loadu_si256((const __m256i *)lo);
+    orig[13] = _mm256_loadu_si256((const __m256i *)hi);
+    memcpy(x, orig, sizeof(x));
+
+    for (int i = 0; i < random->rounds; i += 2) {
+        AVX_QR(x[0], x[4], x[8], x[12])
+        AVX_QR(x[1], x[5], x[9], x[13])
+        AVX_QR(x[2], x[6], x[10], x[14])
+        AVX_QR(x[3], x[7], x[11], x[15])
+        AVX_QR(x[0], x[5], x[10], x[15])
+        AVX_QR(x[1], x[6], x[11], x[12])
+        AVX_QR(x[2], x[7], x[8], x[13])
+        AVX_QR(x[3], x[4], x[9], x[14])
+    }
+
+    for (int i = 0; i < 16; i += 4) {
+        __m256i a = _mm256_add_epi32(x[i], orig[i]);
+        __m256i b = _mm256_add_epi32(x[i + 1], orig[i + 1]);
+        __m256i c = _mm256_add_epi32(x[i + 2], orig[i + 2]);
+        __m256i d = _mm256_add_epi32(x[i + 3], orig[i + 3]);
+        // 4x4 transpose in each 128 bit half: row r holds block r (low
+        // half) and block r + 4 (high half)
+        __m256i ab_lo = _mm256_unpacklo_epi32(a, b), ab_hi = _mm256_unpackhi_epi32(a, b);
+        __m256i cd_lo = _mm256_unpacklo_epi32(c, d), cd_hi = _mm256_unpackhi_epi32(c, d);
+        __m256i r[4];
+        r[0] = _mm256_unpacklo_epi64(ab_lo, cd_lo);
+        r[1] = _mm256_unpackhi_epi64(ab_lo, cd_lo);
+        r[2] = _mm256_unpacklo_epi64(ab_hi, cd_hi);
+        r[3] = _mm256_unpackhi_epi64(ab_hi, cd_hi);
+        for (int k = 0; k < 4; k++) {
+            _mm_storeu_si128((__m128i *)(out + k * 16 + i), _mm256_castsi256_si128(r[k]));
+            _mm_storeu_si128((__m128i *)(out + (k + 4) * 16 + i), _mm256_extracti128_si256(r[k], 1));
+        }
+    }
+}
+
+#endif
+
+#if defined(CHACHA_NEON)
+
+#define NEON_ROTL(v, n) vorrq_u32(vshlq_n_u32(v, n), vshrq_n_u32(v, 32 - (n)))
+#define NEON_QR(a, b, c, d) \
+    a = vaddq_u32(a, b); d = veorq_u32(d, a); \
+    d = vreinterpretq_u32_u16(vrev32q_u16(vreinterpretq_u16_u32(d))); \
+    c = vaddq_u32(c, d); b = veorq_u32(b, c); b = NEON_ROTL(b, 12); \
+    a = vaddq_u32(a, b); d = veorq_u32(d, a); d = NEON_ROTL(d, 8); \
+    c = vaddq_u32(c, d); b = veorq_u32(b, c); b = NEON_ROTL(b, 7);
+
+// 4 blocks, starting at counter
+static void blocks4_neon(const chacha_t * random, uint64_t counter, uint32_t * out) {
+    uint32_t in[16];
+    uint32x4_t x[16], orig[16];
+    input_block(random, counter, in);
+    for (int i = 0; i < 16; i++) {
+        orig[i] = vdupq_n_u32(in[i]);
+    }
+    uint32_t lo[4], hi[4];
+    for (int b = 0; b < 4; b++) {
+        lo[b] = (uint32_t)(counter + b);
+        hi[b] = (uint32_t)((counter + b) >> 32);
+    }
+    orig[12] = vld1q_u32(lo);
+    orig[13] = vld1q_u32(hi);
+    memcpy(x, orig, sizeof(x));
+
+    for (int i = 0; i < random->rounds; i += 2) {
+        NEON_QR(x[0], x[4], x[8], x[12])
+        NEON_QR(x[1], x[5], x[9], x[13])
+        NEON_QR(x[2], x[6], x[10], x[14])
+        NEON_QR(x[3], x[7], x[11], x[15])
+        NEON_QR(x[0], x[5], x[10], x[15])
+        NEON_QR(x[1], x[6], x[11], x[12])
+        NEON_QR(x[2], x[7], x[8], x[13])
+        NEON_QR(x[3], x[4], x[9], x[14])
+    }
+
+    for (int i = 0; i < 16; i += 4) {
+        // interleaved store: lane b of the 4 vectors goes to block b
+        uint32x4x4_t v;
+        v.val[0] = vaddq_u32(x[i], orig[i]);
+        v.val[1] = vaddq_u32(x[i + 1], orig[i + 1]);
+        v.val[2] = vaddq_u32(x[i + 2], orig[i + 2]);
+        v.val[3] = vaddq_u32(x[i + 3], orig[i + 3]);
+        uint32_t tmp[16];
+        vst4q_u32(tmp, v);
+        for (int b = 0; b < 4; b++) {
+            memcpy(out + b * 16 + i, tmp + b * 4, 4 * sizeof(uint32_t));
+        }
+    }
+}
+
+#endif
+
+#if defined(CHACHA_AVX2_DISPATCH)
+static int has_avx2(void) {
+    static int cached = -1;
+    if (cached < 0) {
+        __builtin_cpu_init();
+        cached = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return cached;
+}
+#elif defined(CHACHA_AVX2)
+static int has_avx2(void) {
+    return 1;
+}
+#endif
+
+void chacha_init(chacha_t * random, const uint32_t key[8], uint64_t nonce, int rounds) {
+    memcpy(random->key, key, sizeof(random->key));
+    random->nonce = nonce;
+    random->rounds = rounds;
+    random->counter = 0;
+    random->index = CHACHA_BUFFER;
+#if defined(CHACHA_AVX2_DISPATCH)
+    has_avx2();  // detected here, before a prefetch worker can refill
+#endif
+}
+
+void chacha_advance(chacha_t * random, uint64_t delta) {
+    if (delta < (uint64_t)(CHACHA_BUFFER - random->index)) {
+        random->index += (int)delta;  // still in the buffer
+        return;
+    }
+    // the buffer holds the CHACHA_BLOCKS blocks before counter
+    uint64_t position = (random->counter - CHACHA_BLOCKS) * 16 + random->index + delta;
+    random->counter = position / 16;
+    chacha_refill(random);
+    random->index = (int)(position % 16);
+}
+
+void chacha_refill(chacha_t * random) {
+    uint32_t * out = random->buffer;
+#if defined(CHACHA_AVX2)
+    if (has_avx2()) {
+        blocks8_avx2(random, random->counter, out);
+    } else {
+        blocks4_sse2(random, random->counter, out);
+        blocks4_sse2(random, random->counter + 4, out + 64);
+    }
+#elif defined(CHACHA_SSE2)
+    blocks4_sse2(random, random->counter, out);
+    blocks4_sse2(random, random->counter + 4, out + 64);
+#elif defined(CHACHA_NEON)
+    blocks4_neon(random, random->counter, out);
+    blocks4_neon(random, random->counter + 4, out + 64);
+#else
+    blocks_scalar(random, random->counter, out, CHACHA_BLOCKS);
+#endif
+    random->counter += CHACHA_BLOCKS;
+    random->index = 0;
+}
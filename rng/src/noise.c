@@ -0,0 +1,485 @@
+/**
+ * @file noise.c
+ *
+ * @brief Seeded gradient noise (Perlin and simplex, 2D and 3D)
+ *
+ * Perlin noise follows Ken Perlin's "Improved Noise" (2002), simplex noise
+ * follows Stefan Gustavson's "Simplex noise demystified" (2005). Both hash
+ * lattice points through a caller provided permutation table.
+ */
+#include "noise.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define NOISE_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define NOISE_NEON 1
+#endif
+
+#define NOISE_F2 0.366025403784438646763723170752936183f
+#define NOISE_G2 0.211324865405187117745425609748864241f
+#define NOISE_F3 (1.0f / 3.0f)
+#define NOISE_G3 (1.0f / 6.0f)
+
+static const float grad2_x[8] = { 1.0f, -1.0f,  1.0f, -1.0f, 1.0f, -1.0f, 0.0f,  0.0f };
+static const float grad2_y[8] = { 1.0f,  1.0f, -1.0f, -1.0f, 0.0f,  0.0f, 1.0f, -1.0f };
+
+static const float grad3[12][3] = {
+    { 1, 1, 0}, {-1, 1, 0}, { 1,-1, 0}, {-1,-1, 0},
+    { 1, 0, 1}, {-1, 0, 1}, { 1, 0,-1}, {-1, 0,-1},
+    { 0, 1, 1}, { 0,-1, 1}, { 0, 1,-1}, { 0,-1,-1}
+};
+
+/**
+ * This function initializes the noise with a permutation of 0..255.
+ * @param noise noise state
+ * @param perm permutation of the values 0..255
+ * @param type NOISE_PERLIN or NOISE_SIMPLEX
+ */
+void noise_init(noise_t * noise, const uint8_t perm[256], int type) {
+    memcpy(noise->perm, perm, 256);
+    memcpy(noise->perm + 256, perm, 256);
+    memset(noise->offset, 0, sizeof(noise->offset));
+    noise->type = type;
+}
+
+/**
+ * This function sets the per octave lattice offsets from seeds.
+ * Offsets are whole numbers below 256 (the lattice wraps there), so they
+ * pick another part of the permutation without losing float precision.
+ * @param noise noise state
+ * @param seeds one seed per octave
+ */
+void noise_init_octaves(noise_t * noise, const uint32_t seeds[NOISE_MAX_OCTAVES]) {
+    for (int i = 0; i < NOISE_MAX_OCTAVES; i++) {
+        noise->offset[i][0] = (float)(seeds[i] & 255);
+        noise->offset[i][1] = (float)((seeds[i] >> 8) & 255);
+    }
+}
+
+/**
+ * This function sets the default fractal parameters: 4 octaves of fBm,
+ * lacunarity 2, gain 0.5 and no domain warp.
+ * @param fractal fractal parameters
+ */
+void fractal_init(fractal_t * fractal) {
+    fractal->octaves = 4;
+    fractal->mode = FRACTAL_FBM;
+    fractal->frequency = 1.0f;
+    fractal->lacunarity = 2.0f;
+    fractal->gain = 0.5f;
+    fractal->warp = 0.0f;
+}
+
+static inline float fade(float t) {
+    return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+}
+
+static inline float lerp(float t, float a, float b) {
+    return a + t * (b - a);
+}
+
+static inline float grad2(int hash, float x, float y) {
+    return grad2_x[hash & 7] * x + grad2_y[hash & 7] * y;
+}
+
+static inline float grad3_perlin(int hash, float x, float y, float z) {
+    int h = hash & 15;
+    float u = h < 8 ? x : y;
+    float v = h < 4 ? y : (h == 12 || h == 14 ? x : z);
+    return ((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v);
+}
+
+float noise_perlin2(const noise_t * noise, float x, float y) {
+    const uint8_t * p = noise->perm;
+    float fx = floorf(x);
+    float fy = floorf(y);
+    int ix = (int)fx & 255;
+    int iy = (int)fy & 255;
+    float xf = x - fx;
+    float yf = y - fy;
+    float xf1 = xf - 1.0f;
+    float yf1 = yf - 1.0f;
+    float u = fade(xf);
+    float v = fade(yf);
+    int a = p[ix];
+    int b = p[ix + 1];
+
+    float n00 = grad2(p[a + iy], xf, yf);
+    float n10 = grad2(p[b + iy], xf1, yf);
+    float n01 = grad2(p[a + iy + 1], xf, yf1);
+    float n11 = grad2(p[b + iy + 1], xf1, yf1);
+    return lerp(v, lerp(u, n00, n10), lerp(u, n01, n11));
+}
+
+float noise_perlin3(const noise_t * noise, float x, float y, float z) {
+    const uint8_t * p = noise->perm;
+    float fx = floorf(x);
+    float fy = floorf(y);
+    float fz = floorf(z);
+    int ix = (int)fx & 255;
+    int iy = (int)fy & 255;
+    int iz = (int)fz & 255;
+    x -= fx;
+    y -= fy;
+    z -= fz;
+    float u = fade(x);
+    float v = fade(y);
+    float w = fade(z);
+    int a = p[ix] + iy, aa = p[a] + iz, ab = p[a + 1] + iz;
+    int b = p[ix + 1] + iy, ba = p[b] + iz, bb = p[b + 1] + iz;
+
+    return lerp(w,
+        lerp(v, lerp(u, grad3_perlin(p[aa], x, y, z),
+                        grad3_perlin(p[ba], x - 1, y, z)),
+                lerp(u, grad3_perlin(p[ab], x, y - 1, z),
+                        grad3_perlin(p[bb], x - 1, y - 1, z))),
+        lerp(v, lerp(u, grad3_perlin(p[aa + 1], x, y, z - 1),
+                        grad3_perlin(p[ba + 1], x - 1, y, z - 1)),
+                lerp(u, grad3_perlin(p[ab + 1], x, y - 1, z - 1),
+                        grad3_perlin(p[bb + 1], x - 1, y - 1, z - 1))));
+}
+
+static inline float simplex_corner2(int gi, float x, float y) {
+    float t = 0.5f - x * x - y * y;
+    if (t < 0.0f) {
+        return 0.0f;
+    }
+    t *= t;
+    return t * t * (grad3[gi][0] * x + grad3[gi][1] * y);
+}
+
+float noise_simplex2(const noise_t * noise, float x, float y) {
+    const uint8_t * p = noise->perm;
+    float s = (x + y) * NOISE_F2;
+    float fi = floorf(x + s);
+    float fj = floorf(y + s);
+    float t = (fi + fj) * NOISE_G2;
+    float x0 = x - (fi - t);
+    float y0 = y - (fj - t);
+    int i1 = x0 > y0 ? 1 : 0;
+    int j1 = 1 - i1;
+    float x1 = x0 - i1 + NOISE_G2;
+    float y1 = y0 - j1 + NOISE_G2;
+    float x2 = x0 - 1.0f + 2.0f * NOISE_G2;
+    float y2 = y0 - 1.0f + 2.0f * NOISE_G2;
+    int ii = (int)fi & 255;
+    int jj = (int)fj & 255;
+
+    float n = simplex_corner2(p[ii + p[jj]] % 12, x0, y0)
+        + simplex_corner2(p[ii + i1 + p[jj + j1]] % 12, x1, y1)
+        + simplex_corner2(p[ii + 1 + p[jj + 1]] % 12, x2, y2);
+    return 70.0f * n;
+}
+
+static inline float simplex_corner3(int gi, float x, float y, float z) {
+    float t = 0.6f - x * x - y * y - z * z;
+    if (t < 0.0f) {
+        return 0.0f;
+    }
+    t *= t;
+    return t * t * (grad3[gi][0] * x + grad3[gi][1] * y + grad3[gi][2] * z);
+}
+
+float noise_simplex3(const noise_t * noise, float x, float y, float z) {
+    const uint8_t * p = noise->perm;
+    float s = (x + y + z) * NOISE_F3;
+    float fi = floorf(x + s);
+    float fj = floorf(y + s);
+    float fk = floorf(z + s);
+    float t = (fi + fj + fk) * NOISE_G3;
+    float x0 = x - (fi - t);
+    float y0 = y - (fj - t);
+    float z0 = z - (fk - t);
+    int i1, j1, k1, i2, j2, k2;
+
+    if (x0 >= y0) {
+        if (y0 >= z0) {
+            i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 1; k2 = 0;
+        } else if (x0 >= z0) {
+            i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 0; k2 = 1;
+        } else {
+            i1 = 0; j1 = 0; k1 = 1; i2 = 1; j2 = 0; k2 = 1;
+        }
+    } else {
+        if (y0 < z0) {
+            i1 = 0; j1 = 0; k1 = 1; i2 = 0; j2 = 1; k2 = 1;
+        } else if (x0 < z0) {
+            i1 = 0; j1 = 1; k1 = 0; i2 = 0; j2 = 1; k2 = 1;
+        } else {
+            i1 = 0; j1 = 1; k1 = 0; i2 = 1; j2 = 1; k2 = 0;
+        }
+    }
+
+    int ii = (int)fi & 255;
+    int jj = (int)fj & 255;
+    int kk = (int)fk & 255;
+
+    float n = simplex_corner3(p[ii + p[jj + p[kk]]] % 12, x0, y0, z0)
+        + simplex_corner3(p[ii + i1 + p[jj + j1 + p[kk + k1]]] % 12,
+                          x0 - i1 + NOISE_G3, y0 - j1 + NOISE_G3, z0 - k1 + NOISE_G3)
+        + simplex_corner3(p[ii + i2 + p[jj + j2 + p[kk + k2]]] % 12,
+                          x0 - i2 + 2.0f * NOISE_G3, y0 - j2 + 2.0f * NOISE_G3,
+                          z0 - k2 + 2.0f * NOISE_G3)
+        + simplex_corner3(p[ii + 1 + p[jj + 1 + p[kk + 1]]] % 12,
+                          x0 - 1.0f + 3.0f * NOISE_G3, y0 - 1.0f + 3.0f * NOISE_G3,
+                          z0 - 1.0f + 3.0f * NOISE_G3);
+    return 32.0f * n;
+}
+
+float noise_sample2(const noise_t * noise, float x, float y) {
+    if (noise->type == NOISE_SIMPLEX) {
+        return noise_simplex2(noise, x, y);
+    }
+    return noise_perlin2(noise, x, y);
+}
+
+float noise_sample3(const noise_t * noise, float x, float y, float z) {
+    if (noise->type == NOISE_SIMPLEX) {
+        return noise_simplex3(noise, x, y, z);
+    }
+    return noise_perlin3(noise, x, y, z);
+}
+
+#if defined(NOISE_SSE2) || defined(NOISE_NEON)
+
+#if defined(NOISE_SSE2)
+typedef __m128 vfloat;
+#define v_load(p)       _mm_loadu_ps(p)
+#define v_store(p, a)   _mm_storeu_ps(p, a)
+#define v_set1(f)       _mm_set1_ps(f)
+#define v_add(a, b)     _mm_add_ps(a, b)
+#define v_sub(a, b)     _mm_sub_ps(a, b)
+#define v_mul(a, b)     _mm_mul_ps(a, b)
+
+/* floor for |a| < 2^31: truncate, then step down where truncation rounded up */
+static inline vfloat v_floor(vfloat a, int32_t cell[4]) {
+    __m128i i = _mm_cvttps_epi32(a);
+    vfloat t = _mm_cvtepi32_ps(i);
+    __m128i up = _mm_castps_si128(_mm_cmpgt_ps(t, a));
+    i = _mm_add_epi32(i, up);
+    _mm_storeu_si128((__m128i *)cell, i);
+    return _mm_cvtepi32_ps(i);
+}
+#else
+typedef float32x4_t vfloat;
+#define v_load(p)       vld1q_f32(p)
+#define v_store(p, a)   vst1q_f32(p, a)
+#define v_set1(f)       vdupq_n_f32(f)
+#define v_add(a, b)     vaddq_f32(a, b)
+#define v_sub(a, b)     vsubq_f32(a, b)
+#define v_mul(a, b)     vmulq_f32(a, b)
+
+static inline vfloat v_floor(vfloat a, int32_t cell[4]) {
+    int32x4_t i = vcvtq_s32_f32(a);
+    vfloat t = vcvtq_f32_s32(i);
+    int32x4_t up = vreinterpretq_s32_u32(vcgtq_f32(t, a));
+    i = vaddq_s32(i, up);
+    vst1q_s32(cell, i);
+    return vcvtq_f32_s32(i);
+}
+#endif
+
+static inline vfloat v_fade(vfloat t) {
+    const vfloat c6 = v_set1(6.0f);
+    const vfloat c15 = v_set1(15.0f);
+    const vfloat c10 = v_set1(10.0f);
+    vfloat t3 = v_mul(v_mul(t, t), t);
+    return v_mul(t3, v_add(v_mul(t, v_sub(v_mul(t, c6), c15)), c10));
+}
+
+static inline vfloat v_lerp(vfloat t, vfloat a, vfloat b) {
+    return v_add(a, v_mul(t, v_sub(b, a)));
+}
+
+static inline vfloat v_grad2(const float gx[4], const float gy[4], vfloat x, vfloat y) {
+    return v_add(v_mul(v_load(gx), x), v_mul(v_load(gy), y));
+}
+
+/*
+ * Four Perlin samples along a row. Lattice hashing stays scalar (it is a
+ * table gather), fractional parts, fade curves, gradient dots and the
+ * interpolation run four lanes wide.
+ */
+static void perlin2_row(const noise_t * noise, float * out, uint32_t stride,
+                        float x0, float dx, float y, uint32_t w) {
+    const uint8_t * p = noise->perm;
+    float fy = floorf(y);
+    int iy = (int)fy & 255;
+    float yf = y - fy;
+    vfloat vyf = v_set1(yf);
+    vfloat vyf1 = v_set1(yf - 1.0f);
+    vfloat vv = v_set1(fade(yf));
+    vfloat one = v_set1(1.0f);
+    uint32_t i = 0;
+
+    for (; i + 4 <= w; i += 4) {
+        float xs[4];
+        int32_t cell[4];
+        float gx00[4], gy00[4], gx10[4], gy10[4];
+        float gx01[4], gy01[4], gx11[4], gy11[4];
+        float result[4];
+
+        for (int k = 0; k < 4; k++) {
+            xs[k] = x0 + (float)(i + k) * dx;
+        }
+        vfloat x = v_load(xs);
+        vfloat xf = v_sub(x, v_floor(x, cell));
+        vfloat xf1 = v_sub(xf, one);
+
+        for (int k = 0; k < 4; k++) {
+            int ix = cell[k] & 255;
+            int a = p[ix];
+            int b = p[ix + 1];
+            int h00 = p[a + iy] & 7, h10 = p[b + iy] & 7;
+            int h01 = p[a + iy + 1] & 7, h11 = p[b + iy + 1] & 7;
+            gx00[k] = grad2_x[h00]; gy00[k] = grad2_y[h00];
+            gx10[k] = grad2_x[h10]; gy10[k] = grad2_y[h10];
+            gx01[k] = grad2_x[h01]; gy01[k] = grad2_y[h01];
+            gx11[k] = grad2_x[h11]; gy11[k] = grad2_y[h11];
+        }
+
+        vfloat n00 = v_grad2(gx00, gy00, xf, vyf);
+        vfloat n10 = v_grad2(gx10, gy10, xf1, vyf);
+        vfloat n01 = v_grad2(gx01, gy01, xf, vyf1);
+        vfloat n11 = v_grad2(gx11, gy11, xf1, vyf1);
+        vfloat u = v_fade(xf);
+        v_store(result, v_lerp(vv, v_lerp(u, n00, n10), v_lerp(u, n01, n11)));
+
+        for (int k = 0; k < 4; k++) {
+            out[(i + k) * stride] = result[k];
+        }
+    }
+
+    for (; i < w; i++) {
+        out[i * stride] = noise_perlin2(noise, x0 + (float)i * dx, y);
+    }
+}
+
+#else
+
+static void perlin2_row(const noise_t * noise, float * out, uint32_t stride,
+                        float x0, float dx, float y, uint32_t w) {
+    for (uint32_t i = 0; i < w; i++) {
+        out[i * stride] = noise_perlin2(noise, x0 + (float)i * dx, y);
+    }
+}
+
+#endif
+
+void noise_fill_grid(const noise_t * noise, float * out, uint32_t stride,
+                     float x0, float y0, float dx, float dy,
+                     uint32_t w, uint32_t h) {
+    for (uint32_t j = 0; j < h; j++) {
+        float y = y0 + (float)j * dy;
+        float * row = out + (size_t)j * w * stride;
+        if (noise->type == NOISE_PERLIN) {
+            perlin2_row(noise, row, stride, x0, dx, y, w);
+        } else {
+            for (uint32_t i = 0; i < w; i++) {
+                row[i * stride] = noise_simplex2(noise, x0 + (float)i * dx, y);
+            }
+        }
+    }
+}
+
+static inline float fractal_shape(int mode, float n) {
+    if (mode == FRACTAL_RIDGED) {
+        n = 1.0f - fabsf(n);
+        return n * n;
+    }
+    if (mode == FRACTAL_BILLOW) {
+        return fabsf(n) * 2.0f - 1.0f;
+    }
+    return n;
+}
+
+static inline int fractal_octaves(const fractal_t * fractal) {
+    if (fractal->octaves < 1) {
+        return 1;
+    }
+    return fractal->octaves > NOISE_MAX_OCTAVES ? NOISE_MAX_OCTAVES : fractal->octaves;
+}
+
+static float fractal_sum(const noise_t * noise, const fractal_t * fractal,
+                         int mode, float x, float y) {
+    int octaves = fractal_octaves(fractal);
+    float freq = fractal->frequency;
+    float amp = 1.0f;
+    float sum = 0.0f;
+    float norm = 0.0f;
+
+    for (int o = 0; o < octaves; o++) {
+        float n = noise_sample2(noise, x * freq + noise->offset[o][0],
+                                y * freq + noise->offset[o][1]);
+        sum += fractal_shape(mode, n) * amp;
+        norm += amp;
+        amp *= fractal->gain;
+        freq *= fractal->lacunarity;
+    }
+    return norm != 0.0f ? sum / norm : 0.0f;
+}
+
+float noise_fractal2(const noise_t * noise, const fractal_t * fractal,
+                     float x, float y) {
+    if (fractal->warp != 0.0f) {
+        float qx = fractal_sum(noise, fractal, FRACTAL_FBM, x, y);
+        float qy = fractal_sum(noise, fractal, FRACTAL_FBM, x + 5.2f, y + 1.3f);
+        x += fractal->warp * qx;
+        y += fractal->warp * qy;
+    }
+    return fractal_sum(noise, fractal, fractal->mode, x, y);
+}
+
+#define FRACTAL_ROW 256
+
+void noise_fractal_grid(const noise_t * noise, const fractal_t * fractal,
+                        float * out, uint32_t stride,
+                        float x0, float y0, float dx, float dy,
+                        uint32_t w, uint32_t h) {
+    if (fractal->warp != 0.0f || noise->type != NOISE_PERLIN) {
+        for (uint32_t j = 0; j < h; j++) {
+            float y = y0 + (float)j * dy;
+            float * row = out + (size_t)j * w * stride;
+            for (uint32_t i = 0; i < w; i++) {
+                row[i * stride] = noise_fractal2(noise, fractal, x0 + (float)i * dx, y);
+            }
+        }
+        return;
+    }
+
+    int octaves = fractal_octaves(fractal);
+    float octave[FRACTAL_ROW];
+    float sum[FRACTAL_ROW];
+
+    for (uint32_t j = 0; j < h; j++) {
+        float y = y0 + (float)j * dy;
+        float * row = out + (size_t)j * w * stride;
+
+        for (uint32_t start = 0; start < w; start += FRACTAL_ROW) {
+            uint32_t n = w - start < FRACTAL_ROW ? w - start : FRACTAL_ROW;
+            float x = x0 + (float)start * dx;
+            float freq = fractal->frequency;
+            float amp = 1.0f;
+            float norm = 0.0f;
+
+            memset(sum, 0, n * sizeof(float));
+            for (int o = 0; o < octaves; o++) {
+                perlin2_row(noise, octave, 1, x * freq + noise->offset[o][0], dx * freq,
+                            y * freq + noise->offset[o][1], n);
+                for (uint32_t i = 0; i < n; i++) {
+                    sum[i] += fractal_shape(fractal->mode, octave[i]) * amp;
+                }
+                norm += amp;
+                amp *= fractal->gain;
+                freq *= fractal->lacunarity;
+            }
+            for (uint32_t i = 0; i < n; i++) {
+                row[(start + i) * stride] = norm != 0.0f ? sum[i] / norm : 0.0f;
+            }
+        }
+    }
+}
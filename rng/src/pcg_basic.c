@@ -128,3 +128,34 @@ uint32_t pcg32_boundedrand_r(pcg32_random_t* rng, uint32_t bound)
 //    return pcg32_boundedrand_r(&pcg32_global, bound);
 //}
 
+
+// pcg_advance_lcg_64(state, delta, cur_mult, cur_plus):
+//     Jumps the LCG delta steps ahead in O(log delta) time, from "Random
+//     Number Generation with Arbitrary Stride" (Brown, 1994). Declared in
+//     pcg_variants.h; delta can be negative (as a 2^64 modulus) to go back.
+
+uint64_t pcg_advance_lcg_64(uint64_t state, uint64_t delta, uint64_t cur_mult,
+                            uint64_t cur_plus)
+{
+    uint64_t acc_mult = 1u;
+    uint64_t acc_plus = 0u;
+    while (delta > 0) {
+        if (delta & 1) {
+            acc_mult *= cur_mult;
+            acc_plus = acc_plus * cur_mult + cur_plus;
+        }
+        cur_plus = (cur_mult + 1) * cur_plus;
+        cur_mult *= cur_mult;
+        delta /= 2;
+    }
+    return acc_mult * state + acc_plus;
+}
+
+// pcg32_advance_r(rng, delta):
+//     Multi-step advance function (jump-ahead, jump-back)
+
+void pcg32_advance_r(pcg32_random_t* rng, uint64_t delta)
+{
+    rng->state = pcg_advance_lcg_64(rng->state, delta, 6364136223846793005ULL,
+                                    rng->inc);
+}
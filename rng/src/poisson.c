@@ -0,0 +1,173 @@
+/**
+ * @file poisson.c
+ *
+ * @brief Poisson-disk sampling with Bridson's algorithm
+ */
+#include "poisson.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define POISSON_SQRT1_2 0.70710678118654752440f
+#define POISSON_UNIT (1.0f / 16777216.0f)
+
+/**
+ * This function initializes the parameters: 30 attempts per point, as in
+ * the paper, and no density map.
+ */
+void poisson_init(poisson_t * poisson, float width, float height, float radius) {
+    poisson->width = width;
+    poisson->height = height;
+    poisson->radius = radius;
+    poisson->k = 30;
+    poisson->density = NULL;
+    poisson->density_width = 0;
+    poisson->density_height = 0;
+    poisson->density_stride = 1;
+    poisson->max_radius = radius;
+}
+
+/**
+ * Cells along one side, clamped to 2^31 (also for NaN), so the product of
+ * two sides cannot overflow 64 bits.
+ */
+static inline uint64_t grid_size(float length, float cell) {
+    float n = ceilf(length / cell);
+    return n < 2147483648.0f ? (uint64_t)n : 2147483648u;
+}
+
+uint64_t poisson_capacity(const poisson_t * poisson) {
+    float cell = poisson->radius * POISSON_SQRT1_2;
+    return grid_size(poisson->width, cell) * grid_size(poisson->height, cell);
+}
+
+/**
+ * Grid cell of a coordinate in [0, length): length / cell can be a whole
+ * number, and a coordinate just below length then rounds to cell count
+ * size, past the last cell.
+ */
+static inline int cell_index(float v, float cell, int size) {
+    int i = (int)(v / cell);
+    return i < size ? i : size - 1;
+}
+
+static inline float uniform(poisson_next_fn next, void * ctx) {
+    return (float)(next(ctx) >> 8) * POISSON_UNIT;
+}
+
+static float radius_at(const poisson_t * poisson, float x, float y) {
+    if (!poisson->density) {
+        return poisson->radius;
+    }
+    uint32_t dx = (uint32_t)(x / poisson->width * poisson->density_width);
+    uint32_t dy = (uint32_t)(y / poisson->height * poisson->density_height);
+    if (dx >= poisson->density_width) dx = poisson->density_width - 1;
+    if (dy >= poisson->density_height) dy = poisson->density_height - 1;
+
+    float d = poisson->density[(dy * poisson->density_width + dx) * poisson->density_stride];
+    d = d < 0.0f ? 0.0f : (d > 1.0f ? 1.0f : d);
+    return poisson->max_radius + (poisson->radius - poisson->max_radius) * d;
+}
+
+int poisson_disk(const poisson_t * poisson, poisson_next_fn next, void * ctx,
+                 float * out) {
+    float cell = poisson->radius * POISSON_SQRT1_2;
+    uint64_t cells = poisson_capacity(poisson);
+    if (cells == 0) {
+        return 0;
+    }
+    if (cells > POISSON_MAX_CELLS) {
+        return -1;
+    }
+    // both sides fit in an int from here
+    int gw = (int)grid_size(poisson->width, cell);
+    int gh = (int)grid_size(poisson->height, cell);
+
+    int32_t * grid = (int32_t *)malloc(sizeof(int32_t) * (size_t)cells);
+    int32_t * active = (int32_t *)malloc(sizeof(int32_t) * (size_t)cells);
+    if (!grid || !active) {
+        free(grid);
+        free(active);
+        return -1;
+    }
+    for (int i = 0; i < (int)cells; i++) {
+        grid[i] = -1;
+    }
+
+    int count = 0;
+    int active_count = 0;
+    float x = uniform(next, ctx) * poisson->width;
+    float y = uniform(next, ctx) * poisson->height;
+
+    out[0] = x;
+    out[1] = y;
+    grid[cell_index(y, cell, gh) * gw + cell_index(x, cell, gw)] = 0;
+    active[active_count++] = count++;
+
+    while (active_count > 0) {
+        int slot = (int)(((uint64_t)next(ctx) * (uint32_t)active_count) >> 32);
+        int index = active[slot];
+        float px = out[index * 2];
+        float py = out[index * 2 + 1];
+        float pr = radius_at(poisson, px, py);
+        int found = 0;
+
+        for (int attempt = 0; attempt < poisson->k; attempt++) {
+            // uniform in the annulus [r, 2r] around the active point, by
+            // rejection from its bounding square: no trigonometry, so the
+            // points do not depend on the platform's libm
+            float ox, oy, d2;
+            do {
+                ox = (uniform(next, ctx) * 4.0f - 2.0f) * pr;
+                oy = (uniform(next, ctx) * 4.0f - 2.0f) * pr;
+                d2 = ox * ox + oy * oy;
+            } while (d2 < pr * pr || d2 > 4.0f * pr * pr);
+
+            float cx = px + ox;
+            float cy = py + oy;
+            if (cx < 0.0f || cy < 0.0f || cx >= poisson->width || cy >= poisson->height) {
+                continue;
+            }
+
+            float cr = radius_at(poisson, cx, cy);
+            int gx = cell_index(cx, cell, gw);
+            int gy = cell_index(cy, cell, gh);
+            int reach = (int)ceilf(cr / cell);
+            int x0 = gx - reach < 0 ? 0 : gx - reach;
+            int y0 = gy - reach < 0 ? 0 : gy - reach;
+            int x1 = gx + reach >= gw ? gw - 1 : gx + reach;
+            int y1 = gy + reach >= gh ? gh - 1 : gy + reach;
+            int ok = grid[gy * gw + gx] < 0;
+
+            for (int j = y0; ok && j <= y1; j++) {
+                for (int i = x0; i <= x1; i++) {
+                    int other = grid[j * gw + i];
+                    if (other >= 0) {
+                        float dx = out[other * 2] - cx;
+                        float dy = out[other * 2 + 1] - cy;
+                        if (dx * dx + dy * dy < cr * cr) {
+                            ok = 0;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if (ok) {
+                out[count * 2] = cx;
+                out[count * 2 + 1] = cy;
+                grid[gy * gw + gx] = count;
+                active[active_count++] = count++;
+                found = 1;
+                break;
+            }
+        }
+
+        if (!found) {
+            active[slot] = active[--active_count];
+        }
+    }
+
+    free(grid);
+    free(active);
+    return count;
+}
@@ -0,0 +1,158 @@
+// worker thread of the prefetch rings (prefetch.hpp): one thread for all
+// generators, sleeping until a ring runs half empty
+
+#include "prefetch.hpp"
+
+#if RNG_PREFETCH
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// allocated once and never destroyed: at exit, the worker may still wait
+// on wakeup if the extension was not finalized
+struct Prefetcher {
+    std::mutex rings_lock;  // held during refill passes
+    std::vector<PrefetchRing*> rings;
+    std::thread *worker;
+
+    std::mutex wake_lock;
+    std::condition_variable wakeup;
+    std::atomic<bool> pending;
+    bool stopping;
+
+    Prefetcher(): worker(0), pending(false), stopping(false) {}
+};
+
+static Prefetcher &prefetcher = *new Prefetcher();
+
+// zero initialized before any constructor runs: no ring
+PrefetchTable prefetch_table;
+
+static std::mutex &table_lock = *new std::mutex();  // taken to change the table
+
+bool prefetch_insert(const void *engine, PrefetchRing *ring) {
+    std::lock_guard<std::mutex> lock(table_lock);
+    PrefetchSlot *free = 0;
+    uint32_t i = prefetch_slot(engine);
+    for (uint32_t n = 0; n < PREFETCH_TABLE_SIZE; n++) {
+        PrefetchSlot &slot = prefetch_table.slots[i];
+        const void *key = slot.engine.load(std::memory_order_relaxed);
+        if (key == engine) {
+            slot.ring.store(ring, std::memory_order_relaxed);
+            prefetch_thread_rings() = true;
+            return true;
+        }
+        if (key == PREFETCH_REMOVED && !free) {
+            free = &slot;
+        }
+        if (key == 0) {
+            if (!free) {
+                free = &slot;
+            }
+            break;
+        }
+        i = (i + 1) & (PREFETCH_TABLE_SIZE - 1);
+    }
+    if (!free || prefetch_table.rings.load(std::memory_order_relaxed) >= PREFETCH_MAX_RINGS) {
+        return false;
+    }
+    free->ring.store(ring, std::memory_order_relaxed);
+    free->engine.store(engine, std::memory_order_release);
+    prefetch_table.rings.fetch_add(1, std::memory_order_relaxed);
+    prefetch_thread_rings() = true;
+    return true;
+}
+
+void prefetch_remove(const void *engine) {
+    std::lock_guard<std::mutex> lock(table_lock);
+    uint32_t i = prefetch_slot(engine);
+    for (uint32_t n = 0; n < PREFETCH_TABLE_SIZE; n++) {
+        PrefetchSlot &slot = prefetch_table.slots[i];
+        const void *key = slot.engine.load(std::memory_order_relaxed);
+        if (key == 0) {
+            return;
+        }
+        if (key == engine) {
+            slot.engine.store(PREFETCH_REMOVED, std::memory_order_release);
+            if (prefetch_table.rings.fetch_sub(1, std::memory_order_relaxed) == 1) {
+                // no engine has a ring now, a probe still running can only
+                // miss: the removed slots become unused again, which keeps
+                // probes short
+                for (uint32_t k = 0; k < PREFETCH_TABLE_SIZE; k++) {
+                    prefetch_table.slots[k].engine.store(0, std::memory_order_relaxed);
+                }
+            }
+            return;
+        }
+        i = (i + 1) & (PREFETCH_TABLE_SIZE - 1);
+    }
+}
+
+static void worker_main() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(prefetcher.wake_lock);
+            while (!prefetcher.pending.load() && !prefetcher.stopping) {
+                prefetcher.wakeup.wait(lock);
+            }
+            if (prefetcher.stopping) {
+                return;
+            }
+            prefetcher.pending.store(false);
+        }
+        std::lock_guard<std::mutex> lock(prefetcher.rings_lock);
+        for (size_t i = 0; i < prefetcher.rings.size(); i++) {
+            prefetcher.rings[i]->refill();
+        }
+    }
+}
+
+void prefetch_attach(PrefetchRing *ring) {
+    {
+        std::lock_guard<std::mutex> lock(prefetcher.rings_lock);
+        prefetcher.rings.push_back(ring);
+        if (!prefetcher.worker) {
+            prefetcher.stopping = false;
+            prefetcher.worker = new std::thread(worker_main);
+        }
+    }
+    prefetch_wake();
+}
+
+void prefetch_detach(PrefetchRing *ring) {
+    std::lock_guard<std::mutex> lock(prefetcher.rings_lock);
+    prefetcher.rings.erase(std::remove(prefetcher.rings.begin(), prefetcher.rings.end(), ring), prefetcher.rings.end());
+}
+
+// cheap while a pass is already pending: only the first caller notifies
+void prefetch_wake() {
+    if (prefetcher.pending.exchange(true)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(prefetcher.wake_lock);
+    prefetcher.wakeup.notify_one();
+}
+
+void prefetch_shutdown() {
+    std::thread *thread;
+    {
+        std::lock_guard<std::mutex> lock(prefetcher.rings_lock);
+        thread = prefetcher.worker;
+        prefetcher.worker = 0;
+    }
+    if (!thread) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(prefetcher.wake_lock);
+        prefetcher.stopping = true;
+    }
+    prefetcher.wakeup.notify_one();
+    thread->join();
+    delete thread;
+}
+
+#endif
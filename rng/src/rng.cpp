@@ -3,12 +3,21 @@
 #define MODULE_NAME "rng"
 
 #include "entropy.h"
-#include "pcg_basic.h"
-#include "pcg.h"
-#include "tinymt32.hpp"
+#include "engines.hpp"
+#include "parallel.hpp"
+#include "shared.hpp"
+#include "rng_ffi.h"
+#include "rng_api.h"
+#include "noise.h"
+#include "worley.h"
+#include "poisson.h"
+#include "sequence.h"
 #include <dmsdk/dlib/log.h>
 #include <dmsdk/sdk.h>
 #include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <new>
 #include "lua/lauxlib.h"
 #include "lua/lualib.h"
 
@@ -16,6 +25,160 @@
 #define lua_unboxpointer(L,i)   (*(void **)(lua_touserdata(L, i)))
 #define method(class, name) {#name, class::name}
 
+#define DEFAULT_STREAM "values"
+
+// profiler scopes around batch operations, with the statistics (stats.hpp)
+#if RNG_STATS
+#include <dmsdk/dlib/profile.h>
+#define RNG_PROFILE(name) DM_PROFILE(name)
+#else
+#define RNG_PROFILE(name)
+#endif
+
+typedef uint32_t (*rng_number_fn)(void *instance);
+
+// any generator instance, seen as a plain source of 32 bit numbers
+struct RngSource {
+    rng_number_fn number;
+    void *instance;
+};
+
+// unbiased number in [0, bound), same rejection scheme as pcg32_boundedrand_r
+static uint32_t source_bounded(RngSource *source, uint32_t bound) {
+    uint32_t threshold = -bound % bound;
+    for (;;) {
+        uint32_t r = source->number(source->instance);
+        if (r >= threshold)
+            return r % bound;
+    }
+}
+
+// returns the values of the given stream of a buffer, validating its type
+static void *check_stream(
+    lua_State *L,
+    int narg,
+    int name_arg,
+    dmBuffer::ValueType expected,
+    uint32_t *count,
+    uint32_t *components,
+    uint32_t *stride)
+{
+    dmScript::LuaHBuffer *buffer = dmScript::CheckBuffer(L, narg);
+    const char *name = luaL_optstring(L, name_arg, DEFAULT_STREAM);
+    dmhash_t stream = dmHashString64(name);
+
+    dmBuffer::ValueType type;
+    uint32_t type_count = 0;
+    dmBuffer::Result r = dmBuffer::GetStreamType(buffer->m_Buffer, stream, &type, &type_count);
+    if (r != dmBuffer::RESULT_OK) {
+        luaL_error(L, "buffer has no stream '%s'", name);
+    }
+    if (type != expected) {
+        luaL_error(L, "stream '%s' has the wrong value type", name);
+    }
+
+    void *data = 0;
+    r = dmBuffer::GetStream(buffer->m_Buffer, stream, &data, count, components, stride);
+    if (r != dmBuffer::RESULT_OK) {
+        luaL_error(L, "unable to get stream '%s'", name);
+    }
+    return data;
+}
+
+// gen:poisson_disk(width, height, radius, [k], [options])
+// options: { buffer, stream, density, density_stream, density_width, density_height, max_radius }
+static int poisson_disk_points(lua_State *L, RngSource *source) {
+    RNG_PROFILE("rng.poisson_disk");
+    poisson_t params;
+    poisson_init(&params, luaL_checknumber(L, 2), luaL_checknumber(L, 3), luaL_checknumber(L, 4));
+    params.k = luaL_optinteger(L, 5, params.k);
+
+    if (params.width <= 0 || params.height <= 0 || params.radius <= 0 || params.k < 1) {
+        return luaL_error(L, "width, height, radius and k must be positive");
+    }
+
+    float *points_out = 0;
+    uint32_t points_count = 0, points_components = 0, points_stride = 0;
+    bool has_options = !lua_isnoneornil(L, 6);
+    if (has_options) {
+        luaL_checktype(L, 6, LUA_TTABLE);
+
+        lua_getfield(L, 6, "density");
+        if (!lua_isnil(L, -1)) {
+            int density = lua_gettop(L);
+            uint32_t count, components;
+            lua_getfield(L, 6, "density_stream");
+            params.density = (float*)check_stream(L, density, density + 1, dmBuffer::VALUE_TYPE_FLOAT32,
+                &count, &components, &params.density_stride);
+            lua_getfield(L, 6, "density_width");
+            params.density_width = luaL_checkinteger(L, -1);
+            lua_getfield(L, 6, "density_height");
+            params.density_height = luaL_checkinteger(L, -1);
+            lua_getfield(L, 6, "max_radius");
+            params.max_radius = luaL_optnumber(L, -1, params.radius * 2);
+            lua_pop(L, 4);
+
+            if (params.density_width == 0 || params.density_height == 0
+                || (uint64_t)params.density_width * params.density_height > count) {
+                return luaL_error(L, "density buffer is too small for %dx%d",
+                    params.density_width, params.density_height);
+            }
+            if (params.max_radius < params.radius) {
+                return luaL_error(L, "max_radius cannot be smaller than radius");
+            }
+        }
+        lua_pop(L, 1);
+
+        lua_getfield(L, 6, "buffer");
+        if (!lua_isnil(L, -1)) {
+            int buffer = lua_gettop(L);
+            lua_getfield(L, 6, "stream");
+            points_out = (float*)check_stream(L, buffer, buffer + 1, dmBuffer::VALUE_TYPE_FLOAT32,
+                &points_count, &points_components, &points_stride);
+            lua_pop(L, 1);
+            if (points_components < 2) {
+                return luaL_error(L, "points stream needs 2 components");
+            }
+        }
+        lua_pop(L, 1);
+    }
+
+    uint64_t capacity = poisson_capacity(&params);
+    if (capacity > POISSON_MAX_CELLS) {
+        return luaL_error(L, "radius too small for the area, more than %d cells", (int)POISSON_MAX_CELLS);
+    }
+    float *points = new (std::nothrow) float[2 * (size_t)capacity];
+    if (!points) {
+        return luaL_error(L, "out of memory");
+    }
+    int count = poisson_disk(&params, source->number, source->instance, points);
+    if (count < 0) {
+        delete[] points;
+        return luaL_error(L, "out of memory");
+    }
+
+    if (points_out) {
+        if ((uint32_t)count > points_count) {
+            delete[] points;
+            return luaL_error(L, "buffer holds %d points, but %d were generated", points_count, count);
+        }
+        for (int i = 0; i < count; i++) {
+            points_out[i * points_stride] = points[i * 2];
+            points_out[i * points_stride + 1] = points[i * 2 + 1];
+        }
+        lua_pushinteger(L, count);
+    } else {
+        lua_createtable(L, count * 2, 0);
+        for (int i = 0; i < count * 2; i++) {
+            lua_pushnumber(L, points[i]);
+            lua_rawseti(L, -2, i + 1);
+        }
+    }
+
+    delete[] points;
+    return 1;
+}
+
 
 static int range_error(lua_State *L) {
     lua_pushliteral(L, "min cannot be bigger than max");
@@ -23,11 +186,28 @@ static int range_error(lua_State *L) {
     return 1;        
 }
 
+static int prefetched_error(lua_State *L) {
+    return luaL_error(L, "cannot jump or advance while values are prefetched, seed first or use them up after prefetch(0)");
+}
+
 static int fixed_value(lua_State *L, double value) {
     lua_pushnumber(L, value);
     return 1;
 }
 
+// the userdata at narg if its metatable is the one at index metatable
+// (absolute), else NULL: Lua code cannot set the metatable of a userdata,
+// so this is as safe as luaL_checkudata, and costs nothing in the instances
+static void *to_instance(lua_State *L, int narg, int metatable) {
+    void *ud = lua_touserdata(L, narg);
+    if (ud == NULL || !lua_getmetatable(L, narg)) {
+        return NULL;
+    }
+    bool ours = lua_rawequal(L, -1, metatable);
+    lua_pop(L, 1);
+    return ours ? ud : NULL;
+}
+
 static void RegisterRng(
     lua_State* L, 
     char const* className,  
@@ -48,69 +228,184 @@ static void RegisterRng(
     lua_pushvalue(L, methodtable);
     lua_settable(L, metatable);
 
-    //lua_pushliteral(L, "__gc");
-    //lua_pushcfunction(L, gc_pcg);
-    //lua_settable(L, metatable);
-
-    lua_pop(L, 1);  // drop metatable
+    if (destroy) {
+        lua_pushliteral(L, "__gc");
+        lua_pushvalue(L, metatable);
+        lua_pushcclosure(L, destroy, 1);
+        lua_settable(L, metatable);
+    }
 
-    luaL_openlib(L, 0, methods, 0);  // fill methodtable
+    // fill methodtable, each method gets the metatable as upvalue 1
+    luaL_openlib(L, 0, methods, 1);
     lua_pop(L, 1);  // drop methodtable
 
     lua_register(L, className, create);
 }
 
 
-class LuaPcg32 {
+#if RNG_STATS
+static void push_stats(lua_State *L, const RngStats &stats) {
+    lua_createtable(L, 0, 5);
+    lua_pushnumber(L, stats.draws);
+    lua_setfield(L, -2, "draws");
+    lua_pushnumber(L, stats.rejections);
+    lua_setfield(L, -2, "rejections");
+    lua_pushnumber(L, stats.batches);
+    lua_setfield(L, -2, "batches");
+    lua_pushnumber(L, stats.batch_values);
+    lua_setfield(L, -2, "batch_values");
+    lua_pushnumber(L, stats.max_batch);
+    lua_setfield(L, -2, "max_batch");
+}
+#endif
+
+#if RNG_FINGERPRINT
+// the hash as 16 hex digits: Lua numbers cannot hold 64 bits
+static void push_fingerprint(lua_State *L, const RngFingerprint &print) {
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)print.hash);
+    lua_pushstring(L, hex);
+}
+#endif
+
+// a uint32 or float32 buffer stream, to fill with numbers
+struct FillStream {
+    void *data;
+    bool floats;
+    uint32_t count, components, stride;
+
+    uint32_t size() const {
+        return count * components;
+    }
+
+    // stores n numbers, from number index first on; float32 streams get
+    // numbers in [0, 1), from their upper 24 bits
+    void store(uint32_t first, const uint32_t *values, uint32_t n) const {
+        uint32_t i = first / components, c = first % components;
+        for (uint32_t k = 0; k < n; k++) {
+            if (floats) {
+                ((float*)data)[i * stride + c] = (values[k] >> 8) * (1.0f / 16777216.0f);
+            } else {
+                ((uint32_t*)data)[i * stride + c] = values[k];
+            }
+            if (++c == components) {
+                c = 0;
+                i++;
+            }
+        }
+    }
+};
+
+static FillStream check_fill_stream(lua_State *L, int narg, int name_arg) {
+    dmScript::LuaHBuffer *buffer = dmScript::CheckBuffer(L, narg);
+    const char *name = luaL_optstring(L, name_arg, DEFAULT_STREAM);
+    dmhash_t stream = dmHashString64(name);
+
+    dmBuffer::ValueType type;
+    uint32_t type_count = 0;
+    if (dmBuffer::GetStreamType(buffer->m_Buffer, stream, &type, &type_count) != dmBuffer::RESULT_OK) {
+        luaL_error(L, "buffer has no stream '%s'", name);
+    }
+    if (type != dmBuffer::VALUE_TYPE_UINT32 && type != dmBuffer::VALUE_TYPE_FLOAT32) {
+        luaL_error(L, "stream '%s' must be uint32 or float32", name);
+    }
+
+    FillStream s;
+    s.data = 0;
+    s.floats = type == dmBuffer::VALUE_TYPE_FLOAT32;
+    if (dmBuffer::GetStream(buffer->m_Buffer, stream, &s.data, &s.count, &s.components, &s.stride) != dmBuffer::RESULT_OK) {
+        luaL_error(L, "unable to get stream '%s'", name);
+    }
+    return s;
+}
+
+// draws n numbers from gen into the stream, from number index first on;
+// packed uint32 streams are written directly (block path), others are
+// scattered from chunks, still drawn with fill
+template<class E>
+static void fill_stream(E &gen, const FillStream &s, uint32_t first, uint32_t n) {
+    if (!s.floats && s.stride == s.components) {
+        gen.fill((uint32_t*)s.data + first, n);
+        return;
+    }
+    uint32_t chunk[256];
+    while (n > 0) {
+        uint32_t m = n < 256 ? n : 256;
+        gen.fill(chunk, m);
+        s.store(first, chunk, m);
+        first += m;
+        n -= m;
+    }
+}
+
+// kinds of values of gen:stream
+enum StreamKind {
+    STREAM_NUMBER,
+    STREAM_DOUBLE,
+    STREAM_RANGE,
+    STREAM_DOUBLE_RANGE,
+    STREAM_ROLL,
+    STREAM_TOSS
+};
+
+static const char *const stream_kinds[] = {
+    "number", "double", "range", "double_range", "roll", "toss", NULL
+};
+
+// Lua binding of any engine (see engine.hpp). The engine is stored inline in
+// the userdata, and every method is generated per engine, so the calls into
+// the engine are inlined without any dispatch.
+template<class E>
+class LuaEngine {
     static const char className[];
     static const luaL_reg methods[];
 
-    static Pcg32 *checkInstance(lua_State *L, int narg) {
-        luaL_checktype(L, narg, LUA_TUSERDATA);
-        void *ud = luaL_checkudata(L, narg, className);
+    static EngineUserdata<E> *toUserdata(lua_State *L, int narg, int metatable) {
+        return (EngineUserdata<E>*)to_instance(L, narg, metatable);
+    }
+
+    // in methods, which have the metatable as upvalue (see RegisterRng):
+    // no string keyed registry lookup as in luaL_checkudata
+    static E *checkInstance(lua_State *L, int narg) {
+        EngineUserdata<E> *ud = toUserdata(L, narg, lua_upvalueindex(1));
         if(!ud) luaL_typerror(L, narg, className);
-        return *(Pcg32**)ud;  // unbox pointer
+        return &ud->engine;
     }
 
-    static uint64_t * new_seed() {
-        uint64_t result[2] = {0, 0};
-        entropy_getbytes((void *)result, sizeof(result));
-        return result;
+    // pushes a new userdata, returns the storage for the engine
+    static void *newInstance(lua_State *L) {
+        EngineUserdata<E> *ud = (EngineUserdata<E>*)lua_newuserdata(L, sizeof(EngineUserdata<E>));
+        luaL_getmetatable(L, className);
+        lua_setmetatable(L, -2);
+        return &ud->engine;
     }
 
+    // prefetched values belong to the old seed: they are dropped, and
+    // prefetching restarts from the new state
     static int seed(lua_State *l) {
-        Pcg32 *o = checkInstance(l, 1);
-        long state = luaL_optinteger(l, 2, 0);
-        long inc = 0;
-
-        if (state == 0) {
-            uint64_t* seeds = new_seed();          
-            state = seeds[0];
-            inc = seeds[1];        
-        } else {
-            inc = luaL_optinteger(l, 3, 0);
-        }
-                
-        o->set_seed(state, inc);
+        E *o = checkInstance(l, 1);
+        uint32_t prefetch = o->prefetch_drop();
+        set_seed(o, luaL_optinteger(l, 2, 0));
+        o->prefetch(prefetch);
         return 0;
     }
-    
+
     static int number(lua_State *L) {
-        Pcg32 *o = checkInstance(L, 1);
+        E *o = checkInstance(L, 1);
         uint32_t result = o->number();
         lua_pushnumber(L, result);
         return 1;
     }
 
     static int double_num(lua_State *L) {
-        Pcg32 *o = checkInstance(L, 1);
+        E *o = checkInstance(L, 1);
         double result = o->double_num();
         lua_pushnumber(L, result);
         return 1;
     }
 
     static int range(lua_State *L) {
-        Pcg32 *o = checkInstance(L, 1);
+        E *o = checkInstance(L, 1);
         uint32_t min = luaL_checknumber(L, 2);
         uint32_t max = luaL_checknumber(L, 3);
 
@@ -130,9 +425,9 @@ class LuaPcg32 {
     }
 
     static int double_range(lua_State *L) {
-        Pcg32 *o = checkInstance(L, 1);
-        uint32_t min = luaL_checknumber(L, 2);
-        uint32_t max = luaL_checknumber(L, 3);
+        E *o = checkInstance(L, 1);
+        double min = luaL_checknumber(L, 2);
+        double max = luaL_checknumber(L, 3);
 
         if (min == max)
         {
@@ -150,213 +445,1138 @@ class LuaPcg32 {
     }
 
     static int roll(lua_State *L) {
-        Pcg32 *o = checkInstance(L, 1);
+        E *o = checkInstance(L, 1);
         int result = o->roll();
         lua_pushnumber(L, result);
-        return 1;        
+        return 1;
     }
 
     static int toss(lua_State *L) {
-        Pcg32 *o = checkInstance(L, 1);
+        E *o = checkInstance(L, 1);
         int result = o->toss();
         lua_pushnumber(L, result);
-        return 1;        
+        return 1;
+    }
+
+    // state of a stream closure, the generator itself is kept alive by
+    // the second upvalue
+    struct Stream {
+        E *engine;
+        int kind;
+        uint32_t min, max;
+        double dmin, dmax;
+        bool limited;
+        uint32_t remaining;
+    };
+
+    static int stream_next(lua_State *L) {
+        Stream *s = (Stream*)lua_touserdata(L, lua_upvalueindex(1));
+        if (s->limited) {
+            if (s->remaining == 0) {
+                return 0;
+            }
+            s->remaining--;
+        }
+        switch (s->kind) {
+            case STREAM_NUMBER:
+                lua_pushnumber(L, s->engine->number());
+                break;
+            case STREAM_DOUBLE:
+                lua_pushnumber(L, s->engine->double_num());
+                break;
+            case STREAM_RANGE:
+                lua_pushnumber(L, s->min == s->max ? s->min : s->engine->range(s->min, s->max));
+                break;
+            case STREAM_DOUBLE_RANGE:
+                lua_pushnumber(L, s->dmin == s->dmax ? s->dmin : s->engine->double_range(s->dmin, s->dmax));
+                break;
+            case STREAM_ROLL:
+                lua_pushnumber(L, s->engine->roll());
+                break;
+            default:
+                lua_pushnumber(L, s->engine->toss());
+                break;
+        }
+        return 1;
+    }
+
+    // gen:stream(kind, [min, max], [count])
+    // returns a function giving the next value of that kind at each call,
+    // for generic for loops: for v in gen:stream("range", 1, 100, n) do
+    // bounds are checked once here; without count the stream never ends
+    static int stream(lua_State *L) {
+        E *o = checkInstance(L, 1);
+        int kind = luaL_checkoption(L, 2, NULL, stream_kinds);
+        int count_arg = 3;
+
+        Stream s;
+        s.engine = o;
+        s.kind = kind;
+        if (kind == STREAM_RANGE) {
+            s.min = luaL_checknumber(L, 3);
+            s.max = luaL_checknumber(L, 4);
+            if (s.min > s.max) {
+                return range_error(L);
+            }
+            count_arg = 5;
+        } else if (kind == STREAM_DOUBLE_RANGE) {
+            s.dmin = luaL_checknumber(L, 3);
+            s.dmax = luaL_checknumber(L, 4);
+            if (s.dmin > s.dmax) {
+                return range_error(L);
+            }
+            count_arg = 5;
+        }
+        s.limited = !lua_isnoneornil(L, count_arg);
+        s.remaining = 0;
+        if (s.limited) {
+            lua_Integer count = luaL_checkinteger(L, count_arg);
+            luaL_argcheck(L, count >= 0 && count <= UINT32_MAX, count_arg, "count out of range");
+            s.remaining = (uint32_t)count;
+        }
+
+        *(Stream*)lua_newuserdata(L, sizeof(Stream)) = s;
+        lua_pushvalue(L, 1);
+        lua_pushcclosure(L, stream_next, 2);
+        return 1;
     }
 
-    static int gc_pcg(lua_State *L) {
-        Pcg32 *o = (Pcg32*)lua_unboxpointer(L, 1);
-        delete o;
+    // only in the methods of engines that can jump; the state is ahead of
+    // the prefetched values, so it cannot move while there are some
+    static int jump(lua_State *L) {
+        E *o = checkInstance(L, 1);
+        if (o->prefetched()) {
+            return prefetched_error(L);
+        }
+        o->jump();
         return 0;
     }
-        
+
+    static int long_jump(lua_State *L) {
+        E *o = checkInstance(L, 1);
+        if (o->prefetched()) {
+            return prefetched_error(L);
+        }
+        o->long_jump();
+        return 0;
+    }
+
+    // gen:stats([reset]), nil unless built with RNG_STATS
+    static int stats(lua_State *L) {
+        E *o = checkInstance(L, 1);
+#if RNG_STATS
+        bool reset = lua_toboolean(L, 2);
+        push_stats(L, o->stats());
+        if (reset) {
+            o->stats_reset();
+        }
+#else
+        (void)o;
+        lua_pushnil(L);
+#endif
+        return 1;
+    }
+
+    // gen:fingerprint(): hash, draws; nil unless built with RNG_FINGERPRINT
+    static int fingerprint(lua_State *L) {
+        E *o = checkInstance(L, 1);
+#if RNG_FINGERPRINT
+        push_fingerprint(L, o->fingerprint());
+        lua_pushnumber(L, (lua_Number)o->fingerprint().draws);
+        return 2;
+#else
+        (void)o;
+        lua_pushnil(L);
+        return 1;
+#endif
+    }
+
+    // only in the methods of engines that can advance
+    // gen:advance(delta), skips delta numbers
+    static int advance(lua_State *L) {
+        E *o = checkInstance(L, 1);
+        lua_Number delta = luaL_checknumber(L, 2);
+        luaL_argcheck(L, delta >= 0 && delta <= 9007199254740992.0, 2, "delta out of range");
+        if (o->prefetched()) {
+            return prefetched_error(L);
+        }
+        o->advance((uint64_t)delta);
+        return 0;
+    }
+
+    // gen:prefetch([capacity]), 0 stops
+    // returns whether prefetching is on (never on HTML5)
+    static int prefetch(lua_State *L) {
+        E *o = checkInstance(L, 1);
+        lua_Integer capacity = luaL_optinteger(L, 2, PREFETCH_DEFAULT_CAPACITY);
+        luaL_argcheck(L, capacity >= 0 && capacity <= PREFETCH_MAX_CAPACITY, 2, "capacity out of range");
+        lua_pushboolean(L, o->prefetch((uint32_t)capacity));
+        return 1;
+    }
+
+    // the worker must be done with the engine before Lua frees it
+    static int gc(lua_State *L) {
+        EngineUserdata<E> *ud = toUserdata(L, 1, lua_upvalueindex(1));
+        if (ud) {
+            ud->engine.Release();
+        }
+        return 0;
+    }
+
+    // gen:fill_buffer(buffer, [stream])
+    // uint32 streams get raw numbers, float32 streams numbers in [0, 1)
+    static int fill_buffer(lua_State *L) {
+        RNG_PROFILE("rng.fill_buffer");
+        E *o = checkInstance(L, 1);
+        FillStream s = check_fill_stream(L, 2, 3);
+        o->count_batch(s.size());
+        fill_stream(*o, s, 0, s.size());
+        lua_pushinteger(L, s.size());
+        return 1;
+    }
+
+    // only in the methods of engines that can advance
+    // gen:fill_parallel(buffer, [stream], [options]), options: { threads, chunk }
+    // same values as fill_buffer, drawn by several threads (parallel.hpp)
+    static int fill_parallel(lua_State *L) {
+        RNG_PROFILE("rng.fill_parallel");
+        E *o = checkInstance(L, 1);
+        FillStream s = check_fill_stream(L, 2, 3);
+        lua_Integer threads = parallel_default_threads();
+        lua_Integer chunk = PARALLEL_DEFAULT_CHUNK;
+        if (!lua_isnoneornil(L, 4)) {
+            luaL_checktype(L, 4, LUA_TTABLE);
+            lua_getfield(L, 4, "threads");
+            threads = luaL_optinteger(L, -1, threads);
+            lua_getfield(L, 4, "chunk");
+            chunk = luaL_optinteger(L, -1, chunk);
+            lua_pop(L, 2);
+        }
+        if (threads < 1 || threads > PARALLEL_MAX_THREADS) {
+            return luaL_error(L, "threads must be between 1 and %d", PARALLEL_MAX_THREADS);
+        }
+        if (chunk < 1 || chunk > UINT32_MAX) {
+            return luaL_error(L, "chunk must be positive");
+        }
+        o->count_batch(s.size());
+        parallel_fill(*o, s.size(), (uint32_t)threads, (uint32_t)chunk,
+            [&s](E &lane, uint32_t first, uint32_t n) { fill_stream(lane, s, first, n); });
+        lua_pushinteger(L, s.size());
+        return 1;
+    }
+
+    static uint32_t source_number(void *o) {
+        return ((E*)o)->number();
+    }
+
+    static int poisson_disk(lua_State *L) {
+        RngSource source = { source_number, checkInstance(L, 1) };
+        return poisson_disk_points(L, &source);
+    }
+
+    // seed 0 takes a random seed from entropy, other seeds are reproducible
+    static void set_seed(E *obj, uint64_t seed) {
+        if (seed == 0) {
+            obj->set_random_seed();
+        } else {
+            obj->set_seed(seed);
+        }
+    }
+
     public:
     static void Register(lua_State *l) {
-        //LuaPcg32::Register(l);
-        RegisterRng(l, className, methods, create, gc_pcg);
+        RegisterRng(l, className, methods, create, gc);
     }
-    static int create(lua_State *L) {
-
-        int arg_count = lua_gettop(L);
-        Pcg32 *o = new Pcg32();
 
-        if (arg_count > 0) {
-            long stat = luaL_checknumber(L, 1);
-            long inc = luaL_checknumber(L, 2);
-            o->set_seed(stat, inc);    
+    // anywhere, outside of the methods: looks the metatable up
+    static E *toEngine(lua_State *L, int narg) {
+        if (narg < 0 && narg > LUA_REGISTRYINDEX) {
+            narg = lua_gettop(L) + narg + 1;
         }
-        
-        lua_boxpointer(L, o);
         luaL_getmetatable(L, className);
-        lua_setmetatable(L, -2);
+        EngineUserdata<E> *ud = toUserdata(L, narg, lua_gettop(L));
+        lua_pop(L, 1);
+        return ud ? &ud->engine : NULL;
+    }
+
+    static bool toSource(lua_State *L, int narg, RngSource *source) {
+        E *engine = toEngine(L, narg);
+        if (!engine) return false;
+        source->number = source_number;
+        source->instance = engine;
+        return true;
+    }
+
+    static int create(lua_State *L) {
+        uint64_t seed = luaL_optinteger(L, 1, 0);
+        E *o = new (newInstance(L)) E();
+        set_seed(o, seed);
         return 1;
     }
 };
 
+// gen:seed([state], [inc]), state 0 takes both from entropy
+template<>
+int LuaEngine<Pcg32>::seed(lua_State *l) {
+    Pcg32 *o = checkInstance(l, 1);
+    long state = luaL_optinteger(l, 2, 0);
+    uint32_t prefetch = o->prefetch_drop();
+
+    if (state == 0) {
+        o->set_random_seed();
+    } else {
+        o->set_seed(state, luaL_optinteger(l, 3, 0));
+    }
+    o->prefetch(prefetch);
+    return 0;
+}
 
-class LuaTinyMT32 {
-    static const char className[];
-    static const luaL_reg methods[];
-
-    static TinyMT32 *checkInstance(lua_State *L, int narg) {
-        luaL_checktype(L, narg, LUA_TUSERDATA);
-        void *ud = luaL_checkudata(L, narg, className);
-        if(!ud) luaL_typerror(L, narg, className);
-        return *(TinyMT32**)ud;  // unbox pointer
+// rng.pcg32([state, inc]), random seed without arguments
+template<>
+int LuaEngine<Pcg32>::create(lua_State *L) {
+    int arg_count = lua_gettop(L);
+    Pcg32 *o = new (newInstance(L)) Pcg32();
+
+    if (arg_count > 0) {
+        long stat = luaL_checknumber(L, 1);
+        long inc = luaL_checknumber(L, 2);
+        o->set_seed(stat, inc);
+    } else {
+        o->set_random_seed();
     }
+    return 1;
+}
 
-    static uint32_t* new_seed() {        
-        return TinyMT32::random_seed(4);
+// rng.tinymt32([seed], [param_id])
+template<>
+int LuaEngine<TinyMT32>::create(lua_State *L) {
+    int param_id = luaL_optinteger(L, 2, 0);
+    if (param_id < 0 || param_id >= TINYMT32_PARAM_COUNT) {
+        return luaL_error(L, "param_id must be between 0 and %d", TINYMT32_PARAM_COUNT - 1);
     }
+    uint64_t seed = luaL_optinteger(L, 1, 0);
+    TinyMT32 *o = new (newInstance(L)) TinyMT32(param_id);
+    set_seed(o, seed);
+    return 1;
+}
 
-    static int seed(lua_State *l) {
-        TinyMT32 *o = checkInstance(l, 1);
-        set_seed(o, luaL_optinteger(l, 2, 0));
-        return 0;
+template<> const luaL_reg LuaEngine<Xoshiro128>::methods[];
+template<> const luaL_reg LuaEngine<Xoshiro256>::methods[];
+template<> const luaL_reg LuaEngine<Pcg32>::methods[];
+template<> const luaL_reg LuaEngine<ChaCha8>::methods[];
+template<> const luaL_reg LuaEngine<ChaCha20>::methods[];
+
+// shared generators (shared.hpp): the userdata boxes the generator, which
+// native extensions may still use from other threads
+class LuaShared {
+    static const char className[];
+    static const luaL_reg methods[];
+
+    // in methods, which have the metatable as upvalue, as LuaEngine
+    static SharedGenerator *checkInstance(lua_State *L, int narg) {
+        void *ud = to_instance(L, narg, lua_upvalueindex(1));
+        if(!ud) luaL_typerror(L, narg, className);
+        return *(SharedGenerator**)ud;
     }
 
     static int number(lua_State *L) {
-        TinyMT32 *o = checkInstance(L, 1);
-        uint32_t result = o->number();
-        lua_pushnumber(L, result);
+        lua_pushnumber(L, checkInstance(L, 1)->number());
         return 1;
     }
 
     static int double_num(lua_State *L) {
-        TinyMT32 *o = checkInstance(L, 1);
-        double result = o->double_num();
-        lua_pushnumber(L, result);
+        lua_pushnumber(L, checkInstance(L, 1)->double_num());
         return 1;
     }
 
     static int range(lua_State *L) {
-        TinyMT32 *o = checkInstance(L, 1);
+        SharedGenerator *o = checkInstance(L, 1);
         uint32_t min = luaL_checknumber(L, 2);
         uint32_t max = luaL_checknumber(L, 3);
 
-        if (min == max)
-        {
+        if (min == max) {
             return fixed_value(L, min);
         }
-
-        if (min > max)
-        {
+        if (min > max) {
             return range_error(L);
         }
-                
-        uint32_t result = o->range(min, max);
-        lua_pushnumber(L, result);
+        lua_pushnumber(L, o->range(min, max));
         return 1;
     }
 
     static int double_range(lua_State *L) {
-        TinyMT32 *o = checkInstance(L, 1);
+        SharedGenerator *o = checkInstance(L, 1);
         double min = luaL_checknumber(L, 2);
         double max = luaL_checknumber(L, 3);
 
-        if (min == max)
-        {
+        if (min == max) {
             return fixed_value(L, min);
         }
-
-        if (min > max)
-        {
+        if (min > max) {
             return range_error(L);
         }
-                
-        double result = o->double_range(min, max);
-        lua_pushnumber(L, result);
+        lua_pushnumber(L, o->double_range(min, max));
         return 1;
     }
 
     static int roll(lua_State *L) {
-        TinyMT32 *o = checkInstance(L, 1);
-        int result = o->range(1, 6);
-        lua_pushnumber(L, result);
-        return 1;        
+        lua_pushnumber(L, checkInstance(L, 1)->roll());
+        return 1;
     }
 
     static int toss(lua_State *L) {
-        TinyMT32 *o = checkInstance(L, 1);
-        int result = o->range(0, 1);
+        lua_pushnumber(L, checkInstance(L, 1)->toss());
+        return 1;
+    }
+
+    // shared:lanes(), number of threads which drew from it so far
+    static int lanes(lua_State *L) {
+        lua_pushnumber(L, checkInstance(L, 1)->lanes());
+        return 1;
+    }
+
+    static int gc(lua_State *L) {
+        SharedGenerator **ud = (SharedGenerator**)to_instance(L, 1, lua_upvalueindex(1));
+        if (!ud) {
+            return 0;
+        }
+        delete *ud;
+        *ud = 0;
+        return 0;
+    }
+
+    static uint32_t source_number(void *o) {
+        return ((SharedGenerator*)o)->number();
+    }
+
+    public:
+    static void Register(lua_State *l) {
+        RegisterRng(l, className, methods, create, gc);
+    }
+
+    static SharedGenerator *toShared(lua_State *L, int narg) {
+        void *ud = lua_touserdata(L, narg);
+        if (!ud || !lua_getmetatable(L, narg)) {
+            return 0;
+        }
+        luaL_getmetatable(L, className);
+        bool shared = lua_rawequal(L, -1, -2);
+        lua_pop(L, 2);
+        return shared ? *(SharedGenerator**)ud : 0;
+    }
+
+    static bool toSource(lua_State *L, int narg, RngSource *source) {
+        SharedGenerator *o = toShared(L, narg);
+        if (!o) return false;
+        source->number = source_number;
+        source->instance = o;
+        return true;
+    }
+
+    // rng.shared(name, [seed]), seed 0 or none takes one from entropy
+    static int create(lua_State *L) {
+        const char *name = luaL_checkstring(L, 1);
+        uint64_t seed = luaL_optinteger(L, 2, 0);
+        if (seed == 0 && !entropy_getbytes((void *)&seed, sizeof(seed))) {
+            fallback_entropy_getbytes((void *)&seed, sizeof(seed));
+        }
+
+        SharedGenerator *o = 0;
+#define ENGINE_SHARED(type, engine) \
+        if (strcmp(name, #engine) == 0) o = new SharedRng<type>(seed, #engine);
+        RNG_ENGINES(ENGINE_SHARED)
+#undef ENGINE_SHARED
+        if (!o) {
+            return luaL_error(L, "unknown generator '%s'", name);
+        }
+
+        SharedGenerator **ud = (SharedGenerator**)lua_newuserdata(L, sizeof(SharedGenerator*));
+        *ud = o;
+        luaL_getmetatable(L, className);
+        lua_setmetatable(L, -2);
+        return 1;
+    }
+};
+
+const char LuaShared::className[] = "SharedRng";
+
+const luaL_reg LuaShared::methods[] = {
+    method(LuaShared, number),
+    { "double", LuaShared::double_num },
+    method(LuaShared, range),
+    method(LuaShared, double_range),
+    method(LuaShared, roll),
+    method(LuaShared, toss),
+    method(LuaShared, lanes),
+    {0,0}
+};
+
+SharedGenerator *rng_to_shared(lua_State *L, int index) {
+    return LuaShared::toShared(L, index);
+}
+
+// native API (rng_api.h)
+#define ENGINE_API(type, name) \
+template<> \
+type *rng_to_engine<type>(lua_State *L, int index) { \
+    return LuaEngine<type>::toEngine(L, index); \
+}
+RNG_ENGINES(ENGINE_API)
+#undef ENGINE_API
+
+const char *rng_engine_name(lua_State *L, int index) {
+#define ENGINE_NAME(type, name) \
+    if (LuaEngine<type>::toEngine(L, index)) return #name;
+    RNG_ENGINES(ENGINE_NAME)
+#undef ENGINE_NAME
+    return NULL;
+}
+
+#if RNG_FINGERPRINT
+// the fingerprint of the generator at index, false if it is not one
+static bool to_fingerprint(lua_State *L, int index, RngFingerprint *print) {
+#define ENGINE_FINGERPRINT(type, name) \
+    if (type *o = LuaEngine<type>::toEngine(L, index)) { \
+        *print = o->fingerprint(); \
+        return true; \
+    }
+    RNG_ENGINES(ENGINE_FINGERPRINT)
+#undef ENGINE_FINGERPRINT
+    return false;
+}
+#endif
+
+void *rng_to_generator(lua_State *L, int index, const char *name) {
+#define ENGINE_GENERATOR(type, engine) \
+    if (strcmp(name, #engine) == 0) { \
+        return LuaEngine<type>::toEngine(L, index) ? lua_touserdata(L, index) : NULL; \
+    }
+    RNG_ENGINES(ENGINE_GENERATOR)
+#undef ENGINE_GENERATOR
+    return NULL;
+}
+
+void *rng_to_state(lua_State *L, int index, const char *name) {
+#define ENGINE_STATE(type, engine) \
+    if (strcmp(name, #engine) == 0) { \
+        type *o = LuaEngine<type>::toEngine(L, index); \
+        return o && !o->prefetched() ? (void *)o->native_state() : NULL; \
+    }
+    RNG_ENGINES(ENGINE_STATE)
+#undef ENGINE_STATE
+    return NULL;
+}
+
+static RngSource check_source(lua_State *L, int narg) {
+    RngSource source = { 0, 0 };
+    if (LuaShared::toSource(L, narg, &source)) return source;
+#define ENGINE_SOURCE(type, name) \
+    if (LuaEngine<type>::toSource(L, narg, &source)) return source;
+    RNG_ENGINES(ENGINE_SOURCE)
+#undef ENGINE_SOURCE
+    luaL_typerror(L, narg, "generator");
+    return source;
+}
+
+
+class LuaNoise {
+    static const char className[];
+    static const luaL_reg methods[];
+
+    static noise_t *checkInstance(lua_State *L, int narg) {
+        luaL_checktype(L, narg, LUA_TUSERDATA);
+        void *ud = luaL_checkudata(L, narg, className);
+        if(!ud) luaL_typerror(L, narg, className);
+        return (noise_t*)ud;  // stored inline, no box
+    }
+
+    static int sample(lua_State *L) {
+        noise_t *o = checkInstance(L, 1);
+        float x = luaL_checknumber(L, 2);
+        float y = luaL_checknumber(L, 3);
+        float result;
+
+        if (lua_isnoneornil(L, 4)) {
+            result = noise_sample2(o, x, y);
+        } else {
+            result = noise_sample3(o, x, y, luaL_checknumber(L, 4));
+        }
         lua_pushnumber(L, result);
-        return 1;        
+        return 1;
     }
 
-    static int gc_tmt(lua_State *L) {
-        TinyMT32 *o = (TinyMT32*)lua_unboxpointer(L, 1);
-        delete o;
+    static int fill_grid(lua_State *L) {
+        RNG_PROFILE("rng.noise.fill_grid");
+        noise_t *o = checkInstance(L, 1);
+        float x0 = luaL_checknumber(L, 3);
+        float y0 = luaL_checknumber(L, 4);
+        float dx = luaL_checknumber(L, 5);
+        float dy = luaL_checknumber(L, 6);
+        int w = luaL_checkinteger(L, 7);
+        int h = luaL_checkinteger(L, 8);
+        uint32_t count, components, stride;
+        float *values = (float*)check_stream(L, 2, 9, dmBuffer::VALUE_TYPE_FLOAT32, &count, &components, &stride);
+
+        if (w < 0 || h < 0 || (uint64_t)w * h > count) {
+            return luaL_error(L, "buffer is too small for a %dx%d grid", w, h);
+        }
+
+        noise_fill_grid(o, values, stride, x0, y0, dx, dy, w, h);
         return 0;
     }
 
-    static void set_seed(TinyMT32 *obj, uint32_t seed) {
-        if (seed == 0) {
-            obj->set_seed_by_array(new_seed());
+    static float opt_field(lua_State *L, int narg, const char *name, float def) {
+        lua_getfield(L, narg, name);
+        float result = luaL_optnumber(L, -1, def);
+        lua_pop(L, 1);
+        return result;
+    }
+
+    // reads the optional fractal options table:
+    // { octaves, frequency, lacunarity, gain, type = "fbm"|"ridged"|"billow", warp }
+    static void check_fractal(lua_State *L, int narg, fractal_t *fractal) {
+        fractal_init(fractal);
+        if (lua_isnoneornil(L, narg)) {
+            return;
+        }
+        luaL_checktype(L, narg, LUA_TTABLE);
+
+        lua_getfield(L, narg, "octaves");
+        lua_Integer octaves = luaL_optinteger(L, -1, fractal->octaves);
+        lua_pop(L, 1);
+        if (octaves < 1 || octaves > NOISE_MAX_OCTAVES) {
+            luaL_error(L, "octaves must be between 1 and %d", NOISE_MAX_OCTAVES);
+        }
+        fractal->octaves = (int)octaves;
+        fractal->frequency = opt_field(L, narg, "frequency", fractal->frequency);
+        fractal->lacunarity = opt_field(L, narg, "lacunarity", fractal->lacunarity);
+        fractal->gain = opt_field(L, narg, "gain", fractal->gain);
+        fractal->warp = opt_field(L, narg, "warp", fractal->warp);
+
+        // a negative gain could make the amplitudes sum to 0
+        if (!(fractal->gain >= 0.0f)) {
+            luaL_error(L, "gain cannot be negative");
+        }
+        if (!(fractal->lacunarity > 0.0f)) {
+            luaL_error(L, "lacunarity must be positive");
+        }
+
+        lua_getfield(L, narg, "type");
+        const char *type = luaL_optstring(L, -1, "fbm");
+        if (strcmp(type, "fbm") == 0) {
+            fractal->mode = FRACTAL_FBM;
+        } else if (strcmp(type, "ridged") == 0) {
+            fractal->mode = FRACTAL_RIDGED;
+        } else if (strcmp(type, "billow") == 0) {
+            fractal->mode = FRACTAL_BILLOW;
         } else {
-            obj->set_seed(seed);
+            luaL_error(L, "unknown fractal type '%s'", type);
         }
+        lua_pop(L, 1);
     }
-    
+
+    static int fractal(lua_State *L) {
+        noise_t *o = checkInstance(L, 1);
+        float x = luaL_checknumber(L, 2);
+        float y = luaL_checknumber(L, 3);
+        fractal_t params;
+        check_fractal(L, 4, &params);
+
+        lua_pushnumber(L, noise_fractal2(o, &params, x, y));
+        return 1;
+    }
+
+    static int fill_fractal(lua_State *L) {
+        RNG_PROFILE("rng.noise.fill_fractal");
+        noise_t *o = checkInstance(L, 1);
+        float x0 = luaL_checknumber(L, 3);
+        float y0 = luaL_checknumber(L, 4);
+        float dx = luaL_checknumber(L, 5);
+        float dy = luaL_checknumber(L, 6);
+        int w = luaL_checkinteger(L, 7);
+        int h = luaL_checkinteger(L, 8);
+        fractal_t params;
+        check_fractal(L, 9, &params);
+        uint32_t count, components, stride;
+        float *values = (float*)check_stream(L, 2, 10, dmBuffer::VALUE_TYPE_FLOAT32, &count, &components, &stride);
+
+        if (w < 0 || h < 0 || (uint64_t)w * h > count) {
+            return luaL_error(L, "buffer is too small for a %dx%d grid", w, h);
+        }
+
+        noise_fractal_grid(o, &params, values, stride, x0, y0, dx, dy, w, h);
+        return 0;
+    }
+
     public:
     static void Register(lua_State *l) {
-        RegisterRng(l, className, methods, create, gc_tmt);
+        RegisterRng(l, className, methods, create, 0);
     }
 
     static int create(lua_State *L) {
-        TinyMT32 *o = new TinyMT32();
-        set_seed(o, luaL_optinteger(L, 1, 0));        
-        lua_boxpointer(L, o);
+        RngSource source = check_source(L, 1);
+        const char *kind = luaL_optstring(L, 2, "perlin");
+        int type;
+
+        if (strcmp(kind, "perlin") == 0) {
+            type = NOISE_PERLIN;
+        } else if (strcmp(kind, "simplex") == 0) {
+            type = NOISE_SIMPLEX;
+        } else {
+            return luaL_error(L, "unknown noise type '%s'", kind);
+        }
+
+        // Fisher-Yates shuffle driven by the generator
+        uint8_t perm[256];
+        for (int i = 0; i < 256; i++) {
+            perm[i] = i;
+        }
+        for (int i = 255; i > 0; i--) {
+            int j = source_bounded(&source, i + 1);
+            uint8_t t = perm[i];
+            perm[i] = perm[j];
+            perm[j] = t;
+        }
+
+        // octave offsets come from the same generator, right after the shuffle
+        uint32_t seeds[NOISE_MAX_OCTAVES];
+        for (int i = 0; i < NOISE_MAX_OCTAVES; i++) {
+            seeds[i] = source.number(source.instance);
+        }
+
+        noise_t *o = (noise_t*)lua_newuserdata(L, sizeof(noise_t));
+        noise_init(o, perm, type);
+        noise_init_octaves(o, seeds);
         luaL_getmetatable(L, className);
         lua_setmetatable(L, -2);
         return 1;
     }
 };
+
+
+class LuaWorley {
+    static const char className[];
+    static const luaL_reg methods[];
+
+    static worley_t *checkInstance(lua_State *L, int narg) {
+        luaL_checktype(L, narg, LUA_TUSERDATA);
+        void *ud = luaL_checkudata(L, narg, className);
+        if(!ud) luaL_typerror(L, narg, className);
+        return (worley_t*)ud;  // stored inline, no box
+    }
+
+    static int sample(lua_State *L) {
+        worley_t *o = checkInstance(L, 1);
+        float x = luaL_checknumber(L, 2);
+        float y = luaL_checknumber(L, 3);
+        float cell;
+
+        float result = worley_sample2(o, x, y, &cell);
+        lua_pushnumber(L, result);
+        lua_pushnumber(L, cell);
+        return 2;
+    }
+
+    static int fill_grid(lua_State *L) {
+        RNG_PROFILE("rng.worley.fill_grid");
+        worley_t *o = checkInstance(L, 1);
+        float x0 = luaL_checknumber(L, 3);
+        float y0 = luaL_checknumber(L, 4);
+        float dx = luaL_checknumber(L, 5);
+        float dy = luaL_checknumber(L, 6);
+        int w = luaL_checkinteger(L, 7);
+        int h = luaL_checkinteger(L, 8);
+        uint32_t count, components, stride;
+        float *values = (float*)check_stream(L, 2, 9, dmBuffer::VALUE_TYPE_FLOAT32, &count, &components, &stride);
+
+        if (w < 0 || h < 0 || (uint64_t)w * h > count) {
+            return luaL_error(L, "buffer is too small for a %dx%d grid", w, h);
+        }
+
+        worley_fill_grid(o, values, stride, x0, y0, dx, dy, w, h);
+        return 0;
+    }
+
+    // reads the optional options table:
+    // { metric = "euclidean"|"manhattan"|"chebyshev", output = "f1"|"f2"|"f2-f1", jitter }
+    static void check_options(lua_State *L, int narg, worley_t *worley) {
+        if (lua_isnoneornil(L, narg)) {
+            return;
+        }
+        luaL_checktype(L, narg, LUA_TTABLE);
+
+        lua_getfield(L, narg, "metric");
+        const char *metric = luaL_optstring(L, -1, "euclidean");
+        if (strcmp(metric, "euclidean") == 0) {
+            worley->metric = WORLEY_EUCLIDEAN;
+        } else if (strcmp(metric, "manhattan") == 0) {
+            worley->metric = WORLEY_MANHATTAN;
+        } else if (strcmp(metric, "chebyshev") == 0) {
+            worley->metric = WORLEY_CHEBYSHEV;
+        } else {
+            luaL_error(L, "unknown metric '%s'", metric);
+        }
+        lua_pop(L, 1);
+
+        lua_getfield(L, narg, "output");
+        const char *output = luaL_optstring(L, -1, "f1");
+        if (strcmp(output, "f1") == 0) {
+            worley->output = WORLEY_F1;
+        } else if (strcmp(output, "f2") == 0) {
+            worley->output = WORLEY_F2;
+        } else if (strcmp(output, "f2-f1") == 0) {
+            worley->output = WORLEY_F2_F1;
+        } else {
+            luaL_error(L, "unknown output '%s'", output);
+        }
+        lua_pop(L, 1);
+
+        lua_getfield(L, narg, "jitter");
+        worley->jitter = luaL_optnumber(L, -1, worley->jitter);
+        lua_pop(L, 1);
+        if (worley->jitter < 0 || worley->jitter > 1) {
+            luaL_error(L, "jitter must be between 0 and 1");
+        }
+    }
+
+    public:
+    static void Register(lua_State *l) {
+        RegisterRng(l, className, methods, create, 0);
+    }
+
+    static int create(lua_State *L) {
+        RngSource source = check_source(L, 1);
+        worley_t params;
+        worley_init(&params, 0);
+        check_options(L, 2, &params);
+        // drawn once the options are valid: an error leaves the generator as is
+        params.seed = source.number(source.instance);
+
+        worley_t *o = (worley_t*)lua_newuserdata(L, sizeof(worley_t));
+        *o = params;
+        luaL_getmetatable(L, className);
+        lua_setmetatable(L, -2);
+        return 1;
+    }
+};
+
+
+class LuaSequence {
+    static const char className[];
+    static const luaL_reg methods[];
+
+    static sequence_t *checkInstance(lua_State *L, int narg) {
+        luaL_checktype(L, narg, LUA_TUSERDATA);
+        void *ud = luaL_checkudata(L, narg, className);
+        if(!ud) luaL_typerror(L, narg, className);
+        return (sequence_t*)ud;  // stored inline, no box
+    }
+
+    static int sample(lua_State *L) {
+        sequence_t *o = checkInstance(L, 1);
+        uint32_t index = luaL_checknumber(L, 2);
+        double result[SEQUENCE_MAX_DIMS];
+
+        sequence_sample(o, index, result);
+        for (int d = 0; d < o->dims; d++) {
+            lua_pushnumber(L, result[d]);
+        }
+        return o->dims;
+    }
+
+    static int fill(lua_State *L) {
+        RNG_PROFILE("rng.sequence.fill");
+        sequence_t *o = checkInstance(L, 1);
+        uint32_t start = luaL_checknumber(L, 3);
+        int n = luaL_checkinteger(L, 4);
+        uint32_t count, components, stride;
+        float *values = (float*)check_stream(L, 2, 5, dmBuffer::VALUE_TYPE_FLOAT32, &count, &components, &stride);
+
+        if (components < (uint32_t)o->dims) {
+            return luaL_error(L, "stream needs %d components", o->dims);
+        }
+        if (n < 0 || (uint32_t)n > count) {
+            return luaL_error(L, "buffer is too small for %d points", n);
+        }
+
+        sequence_fill(o, start, n, values, stride);
+        return 0;
+    }
+
+    public:
+    static void Register(lua_State *l) {
+        RegisterRng(l, className, methods, create, 0);
+    }
+
+    static int create(lua_State *L) {
+        const char *kind = luaL_checkstring(L, 1);
+        int dims = luaL_optinteger(L, 2, 2);
+        int type;
+
+        if (strcmp(kind, "sobol") == 0) {
+            type = SEQUENCE_SOBOL;
+        } else if (strcmp(kind, "halton") == 0) {
+            type = SEQUENCE_HALTON;
+        } else if (strcmp(kind, "r2") == 0) {
+            type = SEQUENCE_R2;
+        } else {
+            return luaL_error(L, "unknown sequence '%s'", kind);
+        }
+        if (dims < 1 || dims > SEQUENCE_MAX_DIMS) {
+            return luaL_error(L, "dims must be between 1 and %d", SEQUENCE_MAX_DIMS);
+        }
+
+        // scrambled with seeds drawn from the generator, if one is given
+        uint32_t seeds[SEQUENCE_MAX_DIMS];
+        bool scrambled = !lua_isnoneornil(L, 3);
+        if (scrambled) {
+            RngSource source = check_source(L, 3);
+            for (int d = 0; d < dims; d++) {
+                seeds[d] = source.number(source.instance);
+            }
+        }
+
+        sequence_t *o = (sequence_t*)lua_newuserdata(L, sizeof(sequence_t));
+        sequence_init(o, type, dims, scrambled ? seeds : 0);
+        luaL_getmetatable(L, className);
+        lua_setmetatable(L, -2);
+        return 1;
+    }
+};
+
+
 class Rng
 {
     public:
     Rng() {};
 
-    static int pcg32(lua_State *l) {
-        LuaPcg32::create(l);
+    // rng.new(name, ...): creates any generator by name, with the
+    // arguments of its own constructor
+    static int new_engine(lua_State *l);
+
+    // rng.engine(value): name of the generator, nil for anything else
+    static int engine(lua_State *l) {
+        const char *name = rng_engine_name(l, 1);
+        if (name) {
+            lua_pushstring(l, name);
+        } else {
+            lua_pushnil(l);
+        }
+        return 1;
+    }
+
+    // rng.ffi_api(): the functions of rng_ffi.h as light userdata, by
+    // generator name and then function name (next, double, ...)
+    static int ffi_api(lua_State *l) {
+        lua_newtable(l);
+#define ENGINE_FFI(type, name) \
+        lua_newtable(l); \
+        push_function(l, "next", (void*)rng_##name##_next); \
+        push_function(l, "double", (void*)rng_##name##_double); \
+        push_function(l, "range", (void*)rng_##name##_range); \
+        push_function(l, "double_range", (void*)rng_##name##_double_range); \
+        push_function(l, "roll", (void*)rng_##name##_roll); \
+        push_function(l, "toss", (void*)rng_##name##_toss); \
+        push_function(l, "fill_u32", (void*)rng_##name##_fill_u32); \
+        lua_setfield(l, -2, #name);
+        RNG_ENGINES(ENGINE_FFI)
+#undef ENGINE_FFI
+        return 1;
+    }
+
+    static int noise(lua_State *l) {
+        LuaNoise::create(l);
+        return 1;
+    }
+
+    static int worley(lua_State *l) {
+        LuaWorley::create(l);
+        return 1;
+    }
+
+    static int sequence(lua_State *l) {
+        LuaSequence::create(l);
+        return 1;
+    }
+
+    static int shared(lua_State *l) {
+        return LuaShared::create(l);
+    }
+
+    // rng.fingerprints(gens): the fingerprint hashes of a table of
+    // generators, under the same keys; nil unless built with RNG_FINGERPRINT
+    static int fingerprints(lua_State *l) {
+        luaL_checktype(l, 1, LUA_TTABLE);
+#if RNG_FINGERPRINT
+        lua_newtable(l);
+        lua_pushnil(l);
+        while (lua_next(l, 1)) {
+            RngFingerprint print;
+            if (!to_fingerprint(l, -1, &print)) {
+                return luaL_error(l, "fingerprints: not a generator");
+            }
+            lua_pop(l, 1);
+            lua_pushvalue(l, -1);  // key, kept for lua_next
+            push_fingerprint(l, print);
+            lua_settable(l, -4);
+        }
+#else
+        lua_pushnil(l);
+#endif
         return 1;
     }
 
-    static int tinymt32(lua_State *l) {
-        LuaTinyMT32::create(l);
+    // rng.stats([reset]): totals of all generators, nil unless built with
+    // RNG_STATS
+    static int stats(lua_State *l) {
+#if RNG_STATS
+        bool reset = lua_toboolean(l, 1);
+        push_stats(l, rng_global_stats().load());
+        if (reset) {
+            rng_global_stats().reset();
+        }
+#else
+        lua_pushnil(l);
+#endif
         return 1;
     }
-        
+
+    private:
+    static void push_function(lua_State *l, const char *name, void *function) {
+        lua_pushlightuserdata(l, function);
+        lua_setfield(l, -2, name);
+    }
 };
 
+#define ENGINE_ENTRY(type, name) { #name, LuaEngine<type>::create },
+
+static const struct luaL_reg engines [] =
+{
+    RNG_ENGINES(ENGINE_ENTRY)
+    { NULL, NULL }
+};
+
+int Rng::new_engine(lua_State *l) {
+    const char *name = luaL_checkstring(l, 1);
+    for (const luaL_reg *e = engines; e->name; e++) {
+        if (strcmp(e->name, name) == 0) {
+            lua_remove(l, 1);
+            return e->func(l);
+        }
+    }
+    return luaL_error(l, "unknown generator '%s'", name);
+}
+
 static const struct luaL_reg rnglib [] =
 {
-    { "pcg32", Rng::pcg32 },
-    { "tinymt32", Rng::tinymt32 },
+    RNG_ENGINES(ENGINE_ENTRY)
+    { "new", Rng::new_engine },
+    { "engine", Rng::engine },
+    { "ffi_api", Rng::ffi_api },
+    { "noise", Rng::noise },
+    { "worley", Rng::worley },
+    { "sequence", Rng::sequence },
+    { "shared", Rng::shared },
+    { "stats", Rng::stats },
+    { "fingerprints", Rng::fingerprints },
     { NULL, NULL }
 };
 
-const char LuaPcg32::className[] = "Pcg32";
+#undef ENGINE_ENTRY
+
+#define ENGINE_CLASS_NAME(type, name) \
+    template<> const char LuaEngine<type>::className[] = #type;
+RNG_ENGINES(ENGINE_CLASS_NAME)
+#undef ENGINE_CLASS_NAME
+
+// methods of all engines
+#define ENGINE_METHODS(E) \
+    method(LuaEngine<E>, seed), \
+    method(LuaEngine<E>, number), \
+    { "double", LuaEngine<E>::double_num }, \
+    method(LuaEngine<E>, range), \
+    method(LuaEngine<E>, double_range), \
+    method(LuaEngine<E>, roll), \
+    method(LuaEngine<E>, toss), \
+    method(LuaEngine<E>, poisson_disk), \
+    method(LuaEngine<E>, fill_buffer), \
+    method(LuaEngine<E>, stream), \
+    method(LuaEngine<E>, prefetch), \
+    method(LuaEngine<E>, stats), \
+    method(LuaEngine<E>, fingerprint),
+
+template<class E>
+const luaL_reg LuaEngine<E>::methods[] = {
+    ENGINE_METHODS(E)
+    {0,0}
+};
+
+#define JUMP_METHODS(E) \
+    method(LuaEngine<E>, jump), \
+    method(LuaEngine<E>, long_jump),
+
+#define ADVANCE_METHODS(E) \
+    method(LuaEngine<E>, advance), \
+    method(LuaEngine<E>, fill_parallel),
+
+template<>
+const luaL_reg LuaEngine<Xoshiro128>::methods[] = {
+    ENGINE_METHODS(Xoshiro128)
+    JUMP_METHODS(Xoshiro128)
+    {0,0}
+};
+
+template<>
+const luaL_reg LuaEngine<Xoshiro256>::methods[] = {
+    ENGINE_METHODS(Xoshiro256)
+    JUMP_METHODS(Xoshiro256)
+    {0,0}
+};
+
+template<>
+const luaL_reg LuaEngine<Pcg32>::methods[] = {
+    ENGINE_METHODS(Pcg32)
+    ADVANCE_METHODS(Pcg32)
+    {0,0}
+};
+
+template<>
+const luaL_reg LuaEngine<ChaCha8>::methods[] = {
+    ENGINE_METHODS(ChaCha8)
+    ADVANCE_METHODS(ChaCha8)
+    {0,0}
+};
+
+template<>
+const luaL_reg LuaEngine<ChaCha20>::methods[] = {
+    ENGINE_METHODS(ChaCha20)
+    ADVANCE_METHODS(ChaCha20)
+    {0,0}
+};
+
+const char LuaNoise::className[] = "Noise";
+
+const luaL_reg LuaNoise::methods[] = {
+    method(LuaNoise, sample),
+    method(LuaNoise, fill_grid),
+    method(LuaNoise, fractal),
+    method(LuaNoise, fill_fractal),
+    {0,0}
+};
+
+const char LuaWorley::className[] = "Worley";
 
-const luaL_reg LuaPcg32::methods[] = {
-    method(LuaPcg32, seed),
-    method(LuaPcg32, number),
-    { "double", LuaPcg32::double_num },
-    method(LuaPcg32, range),
-    method(LuaPcg32, double_range),
-    method(LuaPcg32, roll),
-    method(LuaPcg32, toss),
+const luaL_reg LuaWorley::methods[] = {
+    method(LuaWorley, sample),
+    method(LuaWorley, fill_grid),
     {0,0}
 };
 
-const char LuaTinyMT32::className[] = "TinyMT32";
+const char LuaSequence::className[] = "Sequence";
 
-const luaL_reg LuaTinyMT32::methods[] = {
-    method(LuaTinyMT32, seed),
-    method(LuaTinyMT32, number),
-    { "double", LuaTinyMT32::double_num },
-    method(LuaTinyMT32, range),
-    method(LuaTinyMT32, double_range),
-    method(LuaTinyMT32, roll),
-    method(LuaTinyMT32, toss),
+const luaL_reg LuaSequence::methods[] = {
+    method(LuaSequence, sample),
+    method(LuaSequence, fill),
     {0,0}
 };
 
@@ -386,8 +1606,13 @@ dmExtension::Result app_init_rng(dmExtension::AppParams *params)
 dmExtension::Result init_rng(dmExtension::Params *params)
 {
     RngLuaInit(params->m_L); //registers rng
-    LuaPcg32::Register(params->m_L);
-    LuaTinyMT32::Register(params->m_L);
+#define ENGINE_REGISTER(type, name) LuaEngine<type>::Register(params->m_L);
+    RNG_ENGINES(ENGINE_REGISTER)
+#undef ENGINE_REGISTER
+    LuaNoise::Register(params->m_L);
+    LuaWorley::Register(params->m_L);
+    LuaSequence::Register(params->m_L);
+    LuaShared::Register(params->m_L);
     
     dmLogInfo("Registered %s Extension\n", MODULE_NAME);
     return dmExtension::RESULT_OK;
@@ -395,6 +1620,9 @@ dmExtension::Result init_rng(dmExtension::Params *params)
 
 dmExtension::Result app_final_rng(dmExtension::AppParams *params)
 {
+#if RNG_PREFETCH
+    prefetch_shutdown();
+#endif
     return dmExtension::RESULT_OK;
 }
 
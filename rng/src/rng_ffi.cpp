@@ -0,0 +1,35 @@
+// flat C ABI of the generators (rng_ffi.h), instantiated from the same
+// engines as the Lua bindings
+
+#include "engines.hpp"
+#include "rng_ffi.h"
+
+#define ENGINE(type, gen) (((EngineUserdata<type>*)(gen))->engine)
+
+#define RNG_FFI_DEFINE(type, name) \
+    uint32_t rng_##name##_next(void *gen) { \
+        return ENGINE(type, gen).number(); \
+    } \
+    double rng_##name##_double(void *gen) { \
+        return ENGINE(type, gen).double_num(); \
+    } \
+    uint32_t rng_##name##_range(void *gen, uint32_t min, uint32_t max) { \
+        return ENGINE(type, gen).range(min, max); \
+    } \
+    double rng_##name##_double_range(void *gen, double min, double max) { \
+        return ENGINE(type, gen).double_range(min, max); \
+    } \
+    int rng_##name##_roll(void *gen) { \
+        return ENGINE(type, gen).roll(); \
+    } \
+    int rng_##name##_toss(void *gen) { \
+        return ENGINE(type, gen).toss(); \
+    } \
+    void rng_##name##_fill_u32(void *gen, uint32_t *out, uint32_t n) { \
+        ENGINE(type, gen).count_batch(n); \
+        ENGINE(type, gen).fill(out, n); \
+    }
+
+extern "C" {
+RNG_ENGINES(RNG_FFI_DEFINE)
+}
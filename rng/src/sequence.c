@@ -0,0 +1,152 @@
+/**
+ * @file sequence.c
+ *
+ * @brief Low-discrepancy (quasi-random) sequences: Sobol, Halton and R_d
+ */
+#include "sequence.h"
+#include <stddef.h>
+#include <string.h>
+
+#define SEQUENCE_UNIT (1.0 / 4294967296.0)
+#define SEQUENCE_FLOAT_BELOW_ONE 0.99999994f  /* largest float below 1, 1 - 2^-24 */
+
+/* Joe & Kuo (new-joe-kuo-6.21201) parameters for dimensions 2 to 4 */
+static const uint32_t sobol_s[SEQUENCE_MAX_DIMS] = { 0, 1, 2, 3 };
+static const uint32_t sobol_a[SEQUENCE_MAX_DIMS] = { 0, 0, 1, 1 };
+static const uint32_t sobol_m[SEQUENCE_MAX_DIMS][3] = {
+    { 0, 0, 0 }, { 1, 0, 0 }, { 1, 3, 0 }, { 1, 3, 1 }
+};
+
+static const uint32_t halton_base[SEQUENCE_MAX_DIMS] = { 2, 3, 5, 7 };
+
+/*
+ * R_d steps: fractional parts of 1 / phi_d^i, where phi_d is the root of
+ * x^(d+1) = x + 1, as 32 bit fractions (Roberts, "The unreasonable
+ * effectiveness of quasirandom sequences", 2018)
+ */
+static const uint32_t r_step[SEQUENCE_MAX_DIMS][SEQUENCE_MAX_DIMS] = {
+    { 0x9e3779b9 },
+    { 0xc13fa9a9, 0x91e10da5 },
+    { 0xd1b54a32, 0xabc98388, 0x8cb92ba7 },
+    { 0xdb4f0b91, 0xbbe05633, 0xa0f2ec75, 0x89e18285 }
+};
+
+static void sobol_directions(uint32_t v[32], int dim) {
+    uint32_t s = sobol_s[dim];
+    uint32_t a = sobol_a[dim];
+
+    if (dim == 0) {
+        for (int i = 0; i < 32; i++) {
+            v[i] = UINT32_C(1) << (31 - i);
+        }
+        return;
+    }
+    for (uint32_t i = 0; i < s; i++) {
+        v[i] = sobol_m[dim][i] << (31 - i);
+    }
+    for (uint32_t i = s; i < 32; i++) {
+        v[i] = v[i - s] ^ (v[i - s] >> s);
+        for (uint32_t k = 1; k < s; k++) {
+            v[i] ^= ((a >> (s - 1 - k)) & 1) * v[i - k];
+        }
+    }
+}
+
+/**
+ * This function initializes a sequence.
+ * @param sequence sequence state
+ * @param type SEQUENCE_SOBOL, SEQUENCE_HALTON or SEQUENCE_R2
+ * @param dims number of dimensions, 1 to SEQUENCE_MAX_DIMS
+ * @param seeds scrambling seeds, or NULL
+ */
+void sequence_init(sequence_t * sequence, int type, int dims,
+                   const uint32_t seeds[SEQUENCE_MAX_DIMS]) {
+    sequence->type = type;
+    sequence->dims = dims;
+    sequence->scrambled = seeds != NULL;
+    memset(sequence->direction, 0, sizeof(sequence->direction));
+    memset(sequence->seed, 0, sizeof(sequence->seed));
+
+    for (int d = 0; d < dims; d++) {
+        if (seeds) {
+            sequence->seed[d] = seeds[d];
+        }
+        if (type == SEQUENCE_SOBOL) {
+            sobol_directions(sequence->direction[d], d);
+        }
+    }
+}
+
+static inline uint32_t reverse_bits(uint32_t x) {
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+    x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+/* Laine-Karras style hash: only ever flips bits based on lower bits */
+static inline uint32_t owen_scramble(uint32_t x, uint32_t seed) {
+    x = reverse_bits(x);
+    x += seed;
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return reverse_bits(x);
+}
+
+static inline double radical_inverse(uint32_t index, uint32_t base) {
+    uint64_t reversed = 0;
+    uint64_t denominator = 1;
+    while (index > 0) {
+        reversed = reversed * base + index % base;
+        denominator *= base;
+        index /= base;
+    }
+    return (double)reversed / (double)denominator;
+}
+
+static inline double rotate(double u, uint32_t shift) {
+    u += shift * SEQUENCE_UNIT;
+    return u >= 1.0 ? u - 1.0 : u;
+}
+
+static inline double sample_dim(const sequence_t * sequence, uint32_t index, int d) {
+    if (sequence->type == SEQUENCE_SOBOL) {
+        const uint32_t * v = sequence->direction[d];
+        uint32_t x = 0;
+        for (int bit = 0; index; index >>= 1, bit++) {
+            if (index & 1) {
+                x ^= v[bit];
+            }
+        }
+        if (sequence->scrambled) {
+            x = owen_scramble(x, sequence->seed[d]);
+        }
+        return x * SEQUENCE_UNIT;
+    }
+    if (sequence->type == SEQUENCE_HALTON) {
+        return rotate(radical_inverse(index, halton_base[d]), sequence->seed[d]);
+    }
+    /* R_d: x = 1/2 + index * alpha (mod 1), computed exactly in 32 bit fixed point */
+    uint32_t x = UINT32_C(0x80000000) + index * r_step[sequence->dims - 1][d];
+    return (uint32_t)(x + sequence->seed[d]) * SEQUENCE_UNIT;
+}
+
+void sequence_sample(const sequence_t * sequence, uint32_t index, double * out) {
+    for (int d = 0; d < sequence->dims; d++) {
+        out[d] = sample_dim(sequence, index, d);
+    }
+}
+
+void sequence_fill(const sequence_t * sequence, uint32_t start, uint32_t count,
+                   float * out, uint32_t stride) {
+    for (uint32_t i = 0; i < count; i++) {
+        for (int d = 0; d < sequence->dims; d++) {
+            // doubles within 2^-25 of 1 round up to 1.0f, kept below it
+            float value = (float)sample_dim(sequence, start + i, d);
+            out[(size_t)i * stride + d] = value < 1.0f ? value : SEQUENCE_FLOAT_BELOW_ONE;
+        }
+    }
+}
@@ -0,0 +1,331 @@
+/**
+ * @file sfmt.c
+ *
+ * @brief SIMD-oriented Fast Mersenne Twister (SFMT19937)
+ *
+ * @author Mutsuo Saito (Hiroshima University)
+ * @author Makoto Matsumoto (Hiroshima University)
+ *
+ * Copyright (C) 2006, 2007 Mutsuo Saito, Makoto Matsumoto and Hiroshima
+ * University.
+ * Copyright (C) 2012 Mutsuo Saito, Makoto Matsumoto, Hiroshima
+ * University and The University of Tokyo.
+ * All rights reserved.
+ *
+ * The 3-clause BSD License is applied to this software.
+ */
+#include "sfmt.h"
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define SFMT_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define SFMT_NEON 1
+#endif
+
+#define SFMT_POS1 122
+#define SFMT_SL1 18
+#define SFMT_SL2 1
+#define SFMT_SR1 11
+#define SFMT_SR2 1
+#define SFMT_MSK1 0xdfffffefU
+#define SFMT_MSK2 0xddfecb7fU
+#define SFMT_MSK3 0xbffaffffU
+#define SFMT_MSK4 0xbffffff6U
+#define SFMT_PARITY1 0x00000001U
+#define SFMT_PARITY2 0x00000000U
+#define SFMT_PARITY3 0x00000000U
+#define SFMT_PARITY4 0x13c9e684U
+
+static const uint32_t parity[4] = {
+    SFMT_PARITY1, SFMT_PARITY2, SFMT_PARITY3, SFMT_PARITY4
+};
+
+#if defined(SFMT_SSE2)
+
+typedef __m128i vword;
+
+static inline vword v_load(const sfmt_w128_t * p) {
+    return _mm_loadu_si128((const __m128i *)p);
+}
+
+static inline void v_store(sfmt_w128_t * p, vword v) {
+    _mm_storeu_si128((__m128i *)p, v);
+}
+
+static inline vword recursion(vword a, vword b, vword c, vword d) {
+    const __m128i mask = _mm_set_epi32(SFMT_MSK4, SFMT_MSK3, SFMT_MSK2, SFMT_MSK1);
+    __m128i y = _mm_and_si128(_mm_srli_epi32(b, SFMT_SR1), mask);
+    __m128i z = _mm_srli_si128(c, SFMT_SR2);
+    z = _mm_xor_si128(z, a);
+    z = _mm_xor_si128(z, _mm_slli_epi32(d, SFMT_SL1));
+    z = _mm_xor_si128(z, _mm_slli_si128(a, SFMT_SL2));
+    return _mm_xor_si128(z, y);
+}
+
+#elif defined(SFMT_NEON)
+
+typedef uint32x4_t vword;
+
+static inline vword v_load(const sfmt_w128_t * p) {
+    return vld1q_u32(p->u);
+}
+
+static inline void v_store(sfmt_w128_t * p, vword v) {
+    vst1q_u32(p->u, v);
+}
+
+static inline vword recursion(vword a, vword b, vword c, vword d) {
+    static const uint32_t msk[4] = { SFMT_MSK1, SFMT_MSK2, SFMT_MSK3, SFMT_MSK4 };
+    const uint8x16_t zero = vdupq_n_u8(0);
+    uint32x4_t y = vandq_u32(vshrq_n_u32(b, SFMT_SR1), vld1q_u32(msk));
+    uint32x4_t z = vreinterpretq_u32_u8(vextq_u8(vreinterpretq_u8_u32(c), zero, SFMT_SR2));
+    uint32x4_t x = vreinterpretq_u32_u8(vextq_u8(zero, vreinterpretq_u8_u32(a), 16 - SFMT_SL2));
+    z = veorq_u32(z, a);
+    z = veorq_u32(z, vshlq_n_u32(d, SFMT_SL1));
+    z = veorq_u32(z, x);
+    return veorq_u32(z, y);
+}
+
+#else
+
+typedef sfmt_w128_t vword;
+
+static inline vword v_load(const sfmt_w128_t * p) {
+    return *p;
+}
+
+static inline void v_store(sfmt_w128_t * p, vword v) {
+    *p = v;
+}
+
+/* 128-bit shifts by whole bytes, on the little endian 32 bit word layout */
+static inline void lshift128(sfmt_w128_t * out, const sfmt_w128_t * in, int shift) {
+    uint64_t th = ((uint64_t)in->u[3] << 32) | in->u[2];
+    uint64_t tl = ((uint64_t)in->u[1] << 32) | in->u[0];
+    uint64_t oh = th << (shift * 8);
+    uint64_t ol = tl << (shift * 8);
+    oh |= tl >> (64 - shift * 8);
+    out->u[1] = (uint32_t)(ol >> 32);
+    out->u[0] = (uint32_t)ol;
+    out->u[3] = (uint32_t)(oh >> 32);
+    out->u[2] = (uint32_t)oh;
+}
+
+static inline void rshift128(sfmt_w128_t * out, const sfmt_w128_t * in, int shift) {
+    uint64_t th = ((uint64_t)in->u[3] << 32) | in->u[2];
+    uint64_t tl = ((uint64_t)in->u[1] << 32) | in->u[0];
+    uint64_t oh = th >> (shift * 8);
+    uint64_t ol = tl >> (shift * 8);
+    ol |= th << (64 - shift * 8);
+    out->u[1] = (uint32_t)(ol >> 32);
+    out->u[0] = (uint32_t)ol;
+    out->u[3] = (uint32_t)(oh >> 32);
+    out->u[2] = (uint32_t)oh;
+}
+
+static inline vword recursion(vword a, vword b, vword c, vword d) {
+    static const uint32_t msk[4] = { SFMT_MSK1, SFMT_MSK2, SFMT_MSK3, SFMT_MSK4 };
+    sfmt_w128_t x, y, r;
+    lshift128(&x, &a, SFMT_SL2);
+    rshift128(&y, &c, SFMT_SR2);
+    for (int i = 0; i < 4; i++) {
+        r.u[i] = a.u[i] ^ x.u[i] ^ ((b.u[i] >> SFMT_SR1) & msk[i]) ^ y.u[i]
+            ^ (d.u[i] << SFMT_SL1);
+    }
+    return r;
+}
+
+#endif
+
+/**
+ * This function fills the internal state array with pseudorandom
+ * integers.
+ * @param sfmt SFMT internal state
+ */
+void sfmt_gen_rand_all(sfmt_t * sfmt) {
+    sfmt_w128_t * st = sfmt->state;
+    vword r1 = v_load(&st[SFMT_N - 2]);
+    vword r2 = v_load(&st[SFMT_N - 1]);
+    int i;
+
+    for (i = 0; i < SFMT_N - SFMT_POS1; i++) {
+        vword r = recursion(v_load(&st[i]), v_load(&st[i + SFMT_POS1]), r1, r2);
+        v_store(&st[i], r);
+        r1 = r2;
+        r2 = r;
+    }
+    for (; i < SFMT_N; i++) {
+        vword r = recursion(v_load(&st[i]), v_load(&st[i + SFMT_POS1 - SFMT_N]), r1, r2);
+        v_store(&st[i], r);
+        r1 = r2;
+        r2 = r;
+    }
+}
+
+/*
+ * Generates size 128-bit words into array: the state acts as the first
+ * block, and the state ends up holding the last SFMT_N words generated.
+ */
+static void gen_rand_array(sfmt_t * sfmt, sfmt_w128_t * array, int size) {
+    sfmt_w128_t * st = sfmt->state;
+    vword r1 = v_load(&st[SFMT_N - 2]);
+    vword r2 = v_load(&st[SFMT_N - 1]);
+    int i, j;
+
+    for (i = 0; i < SFMT_N - SFMT_POS1; i++) {
+        vword r = recursion(v_load(&st[i]), v_load(&st[i + SFMT_POS1]), r1, r2);
+        v_store(&array[i], r);
+        r1 = r2;
+        r2 = r;
+    }
+    for (; i < SFMT_N; i++) {
+        vword r = recursion(v_load(&st[i]), v_load(&array[i + SFMT_POS1 - SFMT_N]), r1, r2);
+        v_store(&array[i], r);
+        r1 = r2;
+        r2 = r;
+    }
+    for (; i < size - SFMT_N; i++) {
+        vword r = recursion(v_load(&array[i - SFMT_N]),
+                            v_load(&array[i + SFMT_POS1 - SFMT_N]), r1, r2);
+        v_store(&array[i], r);
+        r1 = r2;
+        r2 = r;
+    }
+    for (j = 0; j < 2 * SFMT_N - size; j++) {
+        st[j] = array[j + size - SFMT_N];
+    }
+    for (; i < size; i++, j++) {
+        vword r = recursion(v_load(&array[i - SFMT_N]),
+                            v_load(&array[i + SFMT_POS1 - SFMT_N]), r1, r2);
+        v_store(&array[i], r);
+        v_store(&st[j], r);
+        r1 = r2;
+        r2 = r;
+    }
+}
+
+void sfmt_fill_array32(sfmt_t * sfmt, uint32_t * array, int size) {
+    gen_rand_array(sfmt, (sfmt_w128_t *)array, size / 4);
+    sfmt->idx = SFMT_N32;
+}
+
+static inline uint32_t * state32(sfmt_t * sfmt) {
+    return &sfmt->state[0].u[0];
+}
+
+/**
+ * This function certificate the period of 2^19937-1.
+ * @param sfmt SFMT internal state
+ */
+static void period_certification(sfmt_t * sfmt) {
+    uint32_t * psfmt32 = state32(sfmt);
+    uint32_t inner = 0;
+    int i, j;
+    uint32_t work;
+
+    for (i = 0; i < 4; i++) {
+        inner ^= psfmt32[i] & parity[i];
+    }
+    for (i = 16; i > 0; i >>= 1) {
+        inner ^= inner >> i;
+    }
+    inner &= 1;
+    if (inner == 1) {
+        return;
+    }
+    for (i = 0; i < 4; i++) {
+        work = 1;
+        for (j = 0; j < 32; j++) {
+            if ((work & parity[i]) != 0) {
+                psfmt32[i] ^= work;
+                return;
+            }
+            work = work << 1;
+        }
+    }
+}
+
+static uint32_t func1(uint32_t x) {
+    return (x ^ (x >> 27)) * (uint32_t)1664525UL;
+}
+
+static uint32_t func2(uint32_t x) {
+    return (x ^ (x >> 27)) * (uint32_t)1566083941UL;
+}
+
+/**
+ * This function initializes the internal state array with a 32-bit
+ * integer seed.
+ * @param sfmt SFMT internal state
+ * @param seed a 32-bit integer used as the seed.
+ */
+void sfmt_init_gen_rand(sfmt_t * sfmt, uint32_t seed) {
+    uint32_t * psfmt32 = state32(sfmt);
+
+    psfmt32[0] = seed;
+    for (int i = 1; i < SFMT_N32; i++) {
+        psfmt32[i] = 1812433253UL * (psfmt32[i - 1] ^ (psfmt32[i - 1] >> 30)) + i;
+    }
+    sfmt->idx = SFMT_N32;
+    period_certification(sfmt);
+}
+
+/**
+ * This function initializes the internal state array,
+ * with an array of 32-bit integers used as the seeds
+ * @param sfmt SFMT internal state
+ * @param init_key the array of 32-bit integers, used as a seed.
+ * @param key_length the length of init_key.
+ */
+void sfmt_init_by_array(sfmt_t * sfmt, uint32_t * init_key, int key_length) {
+    uint32_t * psfmt32 = state32(sfmt);
+    const int size = SFMT_N32;
+    const int lag = 11;
+    const int mid = (size - lag) / 2;
+    int i, j, count;
+    uint32_t r;
+
+    memset(sfmt->state, 0x8b, sizeof(sfmt->state));
+    if (key_length + 1 > size) {
+        count = key_length + 1;
+    } else {
+        count = size;
+    }
+    r = func1(psfmt32[0] ^ psfmt32[mid] ^ psfmt32[size - 1]);
+    psfmt32[mid] += r;
+    r += key_length;
+    psfmt32[mid + lag] += r;
+    psfmt32[0] = r;
+
+    count--;
+    for (i = 1, j = 0; (j < count) && (j < key_length); j++) {
+        r = func1(psfmt32[i] ^ psfmt32[(i + mid) % size] ^ psfmt32[(i + size - 1) % size]);
+        psfmt32[(i + mid) % size] += r;
+        r += init_key[j] + i;
+        psfmt32[(i + mid + lag) % size] += r;
+        psfmt32[i] = r;
+        i = (i + 1) % size;
+    }
+    for (; j < count; j++) {
+        r = func1(psfmt32[i] ^ psfmt32[(i + mid) % size] ^ psfmt32[(i + size - 1) % size]);
+        psfmt32[(i + mid) % size] += r;
+        r += i;
+        psfmt32[(i + mid + lag) % size] += r;
+        psfmt32[i] = r;
+        i = (i + 1) % size;
+    }
+    for (j = 0; j < size; j++) {
+        r = func2(psfmt32[i] + psfmt32[(i + mid) % size] + psfmt32[(i + size - 1) % size]);
+        psfmt32[(i + mid) % size] ^= r;
+        r -= i;
+        psfmt32[(i + mid + lag) % size] ^= r;
+        psfmt32[i] = r;
+        i = (i + 1) % size;
+    }
+
+    sfmt->idx = SFMT_N32;
+    period_certification(sfmt);
+}
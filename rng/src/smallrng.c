@@ -0,0 +1,39 @@
+/**
+ * @file smallrng.c
+ *
+ * @brief Seeding of the small state generators
+ */
+#include "smallrng.h"
+#include "xoshiro.h"
+
+void wyrand_init(wyrand_t * random, uint64_t seed) {
+    random->state = seed;
+}
+
+/* same seeding as PractRand: mix the seed in, then skip 12 outputs */
+void sfc32_init(sfc32_t * random, uint64_t seed) {
+    random->a = 0;
+    random->b = (uint32_t)seed;
+    random->c = (uint32_t)(seed >> 32);
+    random->counter = 1;
+    for (int i = 0; i < 12; i++) {
+        sfc32_next(random);
+    }
+}
+
+void sfc64_init(sfc64_t * random, uint64_t seed) {
+    random->a = random->b = random->c = seed;
+    random->counter = 1;
+    for (int i = 0; i < 12; i++) {
+        sfc64_next(random);
+    }
+}
+
+/* the state must not be all zero */
+void romuduojr_init(romuduojr_t * random, uint64_t seed) {
+    random->x = splitmix64_next(&seed);
+    random->y = splitmix64_next(&seed);
+    if (random->x == 0 && random->y == 0) {
+        random->y = 1;
+    }
+}
@@ -0,0 +1,523 @@
+/**
+ * @file tinymt32_params.c
+ *
+ * @brief Precomputed TinyMT32 parameter sets, see tinymt32_params.h
+ *
+ * Columns: mat1, mat2, tmat. Set 0 is the reference TinyMT32 parameter set.
+ */
+#include "tinymt32_params.h"
+
+const uint32_t tinymt32_params[TINYMT32_PARAM_COUNT][3] = {
+    { 0x8f7011ee, 0xfc78ff1f, 0x3793fdff }, { 0xcf7b7775, 0xefb189bd, 0x1849f3e2 },
+    { 0xb723ef67, 0x329907ef, 0xd57b4dd2 }, { 0xe24cbed1, 0x29a2a759, 0xdf12c3b8 },
+    { 0xc6e25296, 0x213a1763, 0x1c0b2bef }, { 0xd9950256, 0x6522e65f, 0x833c55ee },
+    { 0xc59cfd9c, 0x803497d3, 0x15e303b5 }, { 0xaf9f9179, 0xba51a747, 0xce9d2596 },
+    { 0xb3ff251e, 0x60950dcb, 0x91fa725c }, { 0x497dcf9d, 0x9b696715, 0x0b95995d },
+    { 0x4ff201d8, 0xed8c184b, 0x21fe63f6 }, { 0xea874226, 0x572074eb, 0xf9f25ca8 },
+    { 0xbdf44547, 0x3cdd97ff, 0xc4efa08b }, { 0x4be2d093, 0x13c1aebf, 0xbed77935 },
+    { 0x71e399c3, 0x17fce78b, 0xd9057951 }, { 0x6f48e55c, 0x92b3128d, 0x0f7c3daf },
+    { 0xe3f4f4c5, 0xdb5805db, 0x11d25ec4 }, { 0x28f7f167, 0x76b4292b, 0xc54d2693 },
+    { 0xc241a68d, 0xfa266dff, 0xdd58e146 }, { 0x4b154ce6, 0xdc27e117, 0x0a91fd07 },
+    { 0xaf29e14d, 0xaed8e877, 0x7f6cf9dc }, { 0x1e3aac88, 0xcd07375d, 0x129a05b4 },
+    { 0x02cd3571, 0xb7a91769, 0xc227916f }, { 0x64f528d7, 0x1892fb6d, 0x3de7ca83 },
+    { 0xb8f5c2a2, 0x1b2ed149, 0xdf22fed3 }, { 0xc69fdb4d, 0xce9bf68f, 0x0806ecf6 },
+    { 0xa3faee4a, 0x39ac01c9, 0x48b3d1ac }, { 0x026caa12, 0x2beea56f, 0x479da5c9 },
+    { 0xe6382fd9, 0x2f6e9603, 0x4da97f4d }, { 0x00308911, 0xd702b2b5, 0xe8712143 },
+    { 0xda4aa952, 0xd520b45d, 0x530b4cc7 }, { 0x1eaf08a7, 0x1d6a5705, 0x24eead77 },
+    { 0x248a909a, 0x54e6a963, 0x84102f80 }, { 0xadc9e3d0, 0xa2363095, 0x7afbbf85 },
+    { 0x818c4824, 0x7483be11, 0x5857db54 }, { 0xcdcfd996, 0x449f392d, 0x7bb073a5 },
+    { 0x2e67cdd4, 0x9048ff39, 0xe43365a3 }, { 0x8e63747e, 0x93ba1319, 0x65cb58ae },
+    { 0xfaffc917, 0xb3e58fb3, 0x703bdbeb }, { 0xdef27e30, 0x66695d8d, 0xe83f35f5 },
+    { 0x5db41eb0, 0x14fd3ad1, 0x53d57d91 }, { 0x9396959b, 0x6d3c509b, 0xd0328751 },
+    { 0x5686869a, 0x6f1a2a43, 0xc3704a3a }, { 0xaeec8404, 0x39026451, 0x779730f0 },
+    { 0x90fce8e8, 0xec7dc061, 0xefb3539f }, { 0x22388e57, 0xf42edc33, 0xf1c78b86 },
+    { 0x68c4e839, 0x012f5921, 0x625cbb40 }, { 0x8609c8a2, 0x6400d79f, 0xd28edee5 },
+    { 0xaf630e3c, 0x5f1f6c2f, 0xe4bf0632 }, { 0x034373c1, 0x1273c735, 0x1d61cd6c },
+    { 0xce64e614, 0x0885fb7f, 0x9086eafc }, { 0x49914cf5, 0x643dfd2f, 0x40f6dc52 },
+    { 0x3d50f68f, 0x22c523bf, 0x59f73b8f }, { 0xf20678de, 0x2fc955d1, 0x1a79bf7b },
+    { 0x65b78696, 0x08f836db, 0xd1524296 }, { 0xf0a5c8e7, 0xb7109321, 0x94304b57 },
+    { 0x3ac7a7e0, 0x9fac5521, 0xdb19d106 }, { 0x0a758706, 0x03029765, 0xbb928117 },
+    { 0xe8d1b804, 0x5f8cbc2b, 0x97d27d2e }, { 0x65d46ae5, 0x0527a6c5, 0x0bb959ea },
+    { 0xe33937d0, 0x54829ac7, 0x11821d56 }, { 0x9990c2c7, 0xf81c8077, 0x913e7386 },
+    { 0x6675f791, 0x9644a1cf, 0x8cb10ada }, { 0x83c41b1a, 0xde19c167, 0x9719aff2 },
+    { 0x952a2759, 0x629c73f3, 0xf49a8ed1 }, { 0x54a2ce90, 0x96c5c9fd, 0xace85abb },
+    { 0x0f67adbd, 0x7506226b, 0xfdf546b9 }, { 0xe0ce018c, 0xffedca4f, 0x397393a6 },
+    { 0xd29ee2b7, 0x7387869d, 0xa1c768c2 }, { 0x6579d3d5, 0x3386c66b, 0x21694040 },
+    { 0x2445ff9d, 0x8433fee9, 0x76e513b2 }, { 0x1724bfbb, 0x99197dfb, 0x7e98b5ba },
+    { 0xe74aefe2, 0x975547a5, 0x9a7bfaeb }, { 0xbd2ee988, 0xd3e0add9, 0x9dccc575 },
+    { 0x879ffcbe, 0x51830f15, 0x4343c138 }, { 0xe779a7c9, 0x006871b7, 0x01bb409f },
+    { 0x49906b95, 0x55b82d57, 0x3c35e129 }, { 0xe7bb19a6, 0x05d13fc1, 0xe520ecdc },
+    { 0xbf4d47aa, 0x0b0d19c1, 0xe46b204d }, { 0x6194a64e, 0x84adf277, 0xd3d879ca },
+    { 0xdc7d02e8, 0x0c7b5b13, 0xcd8a2b6c }, { 0x69055c18, 0x691d5c7b, 0x2ab23d7e },
+    { 0xd0a7a4e2, 0x41d48f55, 0xc7609548 }, { 0x8c838642, 0xd911abaf, 0x140bc25c },
+    { 0x305eb0f3, 0x8b96e77b, 0xb32a7dca }, { 0xaa4ca475, 0x17d573bf, 0xe239b350 },
+    { 0x0132bd10, 0x57cb5269, 0xfa9b16e0 }, { 0x8c2c3230, 0x1c1ce065, 0xc96f3814 },
+    { 0x55cb3b56, 0x1487ee37, 0xee9008ca }, { 0xc61a6437, 0xf4df486d, 0x8d8d5746 },
+    { 0xbacb60ec, 0x3d756427, 0xb7f9b2b6 }, { 0xbc635a80, 0x83af4651, 0xb1e6776b },
+    { 0x8549d307, 0x930dbb69, 0xc9115694 }, { 0x860b2dca, 0x14579597, 0xb2292654 },
+    { 0x0d05d03e, 0x8d7ec97f, 0xe3f58e2f }, { 0x685678e6, 0x1766095f, 0x88a2fdc5 },
+    { 0xb4c2e8af, 0x76c64f17, 0x16986773 }, { 0x97b62171, 0x9cfdf249, 0x9887b789 },
+    { 0xd104085d, 0xc269ac8d, 0xf4c610f6 }, { 0x573999be, 0x6d152dad, 0xc3251ac3 },
+    { 0xb6153a12, 0x26c7f123, 0x40f1c085 }, { 0x5ce1edf2, 0xb4433c85, 0x548c4212 },
+    { 0xbd225c36, 0x5a6a286b, 0x18d77f97 }, { 0xbcc4f348, 0x5aff85d9, 0xbd04c70e },
+    { 0x606ec9a8, 0x417e6421, 0x5947cf7e }, { 0xc2ccbaa8, 0x3dc8be79, 0xab394067 },
+    { 0x73f339b2, 0x5c7f1a4d, 0x53909835 }, { 0x4942962c, 0xab5ff805, 0xe705a183 },
+    { 0x562bd0ae, 0x38a47e09, 0xc2517f31 }, { 0x92bfffd0, 0x93ddda41, 0x8630e7ce },
+    { 0x95aff874, 0x45cba065, 0x97b9370e }, { 0xb9c4a436, 0x0d3e67c5, 0xc6f22b0a },
+    { 0xbefff09b, 0x78d30a0f, 0x19cf61bd }, { 0xd6c12b9f, 0x3d23d60d, 0x8babfd3e },
+    { 0xf3cca4bf, 0xa78e9d3f, 0x129edc46 }, { 0xb7a89dff, 0x9800ad17, 0x16967c8d },
+    { 0xfa4cbbd2, 0x43cb94f5, 0x61316a73 }, { 0x6555d44e, 0xca2ceebd, 0x8752ba62 },
+    { 0x048a8fea, 0x30e2d43f, 0xec4a828a }, { 0xc9bbf9d8, 0xb882f67d, 0xd340e347 },
+    { 0x1c0f3276, 0xc023ac51, 0x538975a5 }, { 0x1aaedcb3, 0x686432b3, 0x9c3165f3 },
+    { 0x634021cc, 0xe58119d3, 0x784ff173 }, { 0x525d2c33, 0x8dbbf289, 0x93c5ac49 },
+    { 0x531a8a43, 0x2d4178c3, 0xc9051a1f }, { 0xfd156e40, 0xf64b88e7, 0x6818cfa4 },
+    { 0xd7d23d24, 0x8865b965, 0x5114df53 }, { 0xd8f79438, 0x0cd686e9, 0x376a5957 },
+    { 0x73e90579, 0x71de0e55, 0x0b8dc8ed }, { 0xad326b8a, 0xbef17a7f, 0x185371ce },
+    { 0xf65e4060, 0x8e5c6da3, 0x4843736c }, { 0xff3ff9c1, 0x20d9bf39, 0xbf7bc43b },
+    { 0xb9f489b9, 0x74e1ee89, 0x83f46236 }, { 0x503ac657, 0x4c6f8783, 0x9c6e7151 },
+    { 0x524c08b6, 0xb98f45d5, 0xccb1a106 }, { 0xd04ace0d, 0xf9c29e65, 0x47d76b28 },
+    { 0x53c7d17f, 0xca1c2c31, 0x9088f77d }, { 0xda288bc1, 0x3fcc17bf, 0x11bf5c57 },
+    { 0xb6c985a6, 0xb886d317, 0x8f075fd5 }, { 0x2ea01547, 0xd287f30b, 0xda39d329 },
+    { 0x9d8f20ff, 0x0cd171a1, 0xc43c89be }, { 0x63e200a9, 0x2e13bec3, 0x277330a1 },
+    { 0x1f97a70d, 0x287368c5, 0xcdb78cbc }, { 0x48e9aacf, 0x701d75b7, 0xa270e592 },
+    { 0x25c26b57, 0x74574f77, 0x159aec56 }, { 0x3446121b, 0xadf63989, 0xced2b32c },
+    { 0xd06f8f5b, 0x0e6c6bdd, 0xd617c86b }, { 0x5c93de89, 0x55db0d97, 0xe5b3d698 },
+    { 0x44ab2782, 0xfe35f031, 0xe69507b8 }, { 0xa8f729db, 0x59154c37, 0x15793f33 },
+    { 0x09e5ac29, 0xad3af69b, 0x0064f786 }, { 0xbe967248, 0x5301ab29, 0xa5cccbab },
+    { 0x9bff07c7, 0xdea64891, 0x11273a6e }, { 0xa57898e9, 0x62920c1f, 0xecb1ad7d },
+    { 0x4f079a74, 0x492e49ff, 0x63843495 }, { 0xa5d43419, 0xdf5302ad, 0xcf419f01 },
+    { 0xc1d3fa59, 0xde1f2c79, 0xbb5a51ae }, { 0xbcc7f430, 0x2d1e45bd, 0xe2cea5b3 },
+    { 0x9635feb6, 0xd6179dd9, 0xcae8e9a7 }, { 0xcb8e5cee, 0x481d1c0d, 0xb6f00c98 },
+    { 0x591cb6e5, 0x6c48fdb5, 0xbb445352 }, { 0x57cefe86, 0xf11db4a3, 0x3361a384 },
+    { 0xb8ae223b, 0x1bcfb4ef, 0x66e0f48c }, { 0xd4ade802, 0xacf0c519, 0x1622e9af },
+    { 0xee73d4b2, 0x5f47afa9, 0xec30f813 }, { 0xfcba3e8b, 0x220ea5f3, 0x75d9ba37 },
+    { 0x6685bbc4, 0xb1e18393, 0xdd3bdfff }, { 0xf0322e95, 0x99e90a2b, 0xb0848331 },
+    { 0xa073bb9a, 0x797c7b29, 0xe427f82f }, { 0xe9f921ac, 0x3ef5a4bd, 0xec04e4b5 },
+    { 0xf60ff1e7, 0x2d34aa7d, 0xe794b00a }, { 0x528a5964, 0xdad300f9, 0x334255a2 },
+    { 0xf136a793, 0x5171a2c7, 0x736708c4 }, { 0xc2f10eea, 0xc51c4dbb, 0x9e23d56c },
+    { 0x9ca43d1e, 0x0a9aaf45, 0x400421d7 }, { 0x39b95cd9, 0xd78d5d1f, 0x90442871 },
+    { 0x0490c6d3, 0x4a78d137, 0x4cb501e9 }, { 0x48f6c045, 0xa4e9faf5, 0x8c0155e5 },
+    { 0xb7e9161d, 0x95ae6039, 0xaf81b3be }, { 0xa98fafcf, 0xce04aab5, 0x3334de96 },
+    { 0xe8830f61, 0x650bd775, 0x6e226bc0 }, { 0x9e158502, 0x39264197, 0xcce072f9 },
+    { 0xa07fb899, 0x339800ff, 0x804340ca }, { 0xde97d17e, 0x59f232db, 0x126d4e41 },
+    { 0x925a18d9, 0x7c50eac1, 0xe05e3bd0 }, { 0x5a8bcefb, 0x04e03183, 0x6cdde5bd },
+    { 0x3a85f890, 0x2daaa4b3, 0x1d7996db }, { 0x50f7ad06, 0xc93fc1cd, 0xc874d7e4 },
+    { 0x372f06a9, 0x257a9aa7, 0x260e1937 }, { 0xb194a66f, 0xa064dcbf, 0x8c055940 },
+    { 0x343aa3bc, 0x4443d825, 0xc4df7299 }, { 0x9034bdc5, 0xccc4e573, 0xbe335963 },
+    { 0xcc058fad, 0x79edd967, 0xa387a450 }, { 0x43b30a01, 0x48e45c65, 0x070f494c },
+    { 0x8925c3e3, 0xf69c5521, 0x53a8189a }, { 0x041b8fe8, 0x091b2447, 0xb4e732f2 },
+    { 0xe25ca18e, 0x13c33eef, 0x006da96e }, { 0x38158a02, 0xacd9e055, 0xf4967995 },
+    { 0x65224cac, 0xae0cddb7, 0xfbffd616 }, { 0x8d376dbf, 0xc97fa8a3, 0x40e21f01 },
+    { 0x789d261f, 0x9035fb4f, 0xf3f3734d }, { 0x21f9cb60, 0x22f664dd, 0xaea0dcce },
+    { 0x51f8cf94, 0x1ab923b5, 0x4cc92bd2 }, { 0x4bc94af1, 0xbd90d5bf, 0xa0988cfa },
+    { 0x8e91cea5, 0x28fda0d7, 0x28d0557d }, { 0xfe2b13c3, 0x7a2d685b, 0x1387c97e },
+    { 0xc7572970, 0xed431ee9, 0x7f3fc3b7 }, { 0xd42d3a1c, 0x427b5ae5, 0x9ffe11c0 },
+    { 0xb78a67f1, 0xbaa1656b, 0xf3ead0fd }, { 0x3c3445f1, 0xb57cd11b, 0x80e922d2 },
+    { 0x7aa9369f, 0x30c080b3, 0x6843ac4e }, { 0x17bb1259, 0x5df4c155, 0x3a48de39 },
+    { 0x46933a50, 0xe7713de9, 0x969620b6 }, { 0xe40f7f4e, 0x340a2ba9, 0xc7cf99ae },
+    { 0xf026b723, 0x8a2d771d, 0x3a1dec48 }, { 0x087399df, 0x6765bc7d, 0x2b5f72dc },
+    { 0x3f316335, 0xda96b0f5, 0xcd072167 }, { 0xc071287b, 0xf3d36abd, 0x78ba9ff1 },
+    { 0x0d4c819e, 0xfaeb49fb, 0xc1b3a8b7 }, { 0x0ede6ea1, 0x1d92d5bb, 0x8e0b97c9 },
+    { 0x5a47f48e, 0x6e50fee7, 0x044d1944 }, { 0x2c155791, 0x3a75ced3, 0x659fab52 },
+    { 0x1903df90, 0x8177b5c1, 0xca3d78a5 }, { 0x20118ce6, 0x61b1da0b, 0x720520f3 },
+    { 0x6943340b, 0xdf1f414b, 0x8c482a24 }, { 0xebe8bb3d, 0x2650e717, 0xb0b7b2f9 },
+    { 0x5ede91f2, 0x54ff35ab, 0x7753a458 }, { 0xcc4a142d, 0xfae1f55b, 0x001469f3 },
+    { 0x022eeca9, 0x35535711, 0x11f456fb }, { 0xed4ce91b, 0xe54d7d69, 0x57e29a0f },
+    { 0xf75e5e23, 0x9e0c20fd, 0xa536856d }, { 0x8fd85d9e, 0x2dac72cd, 0x2cb7e3b9 },
+    { 0x3461c3ed, 0xb78bc89b, 0x8ac3cac9 }, { 0x11b4d722, 0x992d4da7, 0xcbc29e12 },
+    { 0x6da49bd0, 0x98d800dd, 0x265220ea }, { 0xb0ec66f9, 0x8104b793, 0x7c2f14a1 },
+    { 0xcd308154, 0x59aad6b3, 0xa3adf8b5 }, { 0x47c24f28, 0x09ede5b3, 0xabc48ac8 },
+    { 0x0ff7aa4d, 0x88a03433, 0x0da31899 }, { 0x16425355, 0x0377977f, 0x44848548 },
+    { 0x3fdcae12, 0x685dd457, 0xe5b04044 }, { 0x72c9f94b, 0xcf11c1f9, 0xd0ddf3cd },
+    { 0x544358ad, 0x4f2ebe73, 0x9d3c5ab3 }, { 0xb5a47c9e, 0x4b5819ab, 0xddf2b47b },
+    { 0x4b661dce, 0x9c5de38b, 0xf2ddd427 }, { 0x1a90cc99, 0x860f8151, 0x4eb76a71 },
+    { 0x238f5652, 0x7f996bb3, 0xd8a56f80 }, { 0x1f9ac9ae, 0xa534de6b, 0x726fbb78 },
+    { 0xeef9a047, 0x195b5509, 0xff584669 }, { 0x50dcc77c, 0xb828ccb9, 0xe62444c8 },
+    { 0xb09d0745, 0xb95719a5, 0xbd6fad7e }, { 0x59460435, 0x1a3dfcc5, 0x9c9fd493 },
+    { 0xe7b933d6, 0x38ebc317, 0x994f3a3e }, { 0x1d5bcc6b, 0x69f8e2fb, 0xf513911f },
+    { 0xe33a6e98, 0x6ff2acc7, 0xfa04f47b }, { 0x20be8721, 0x92b1d4a7, 0xcc85f660 },
+    { 0x99c9bc1d, 0x303cbd15, 0x755a00e7 }, { 0xc3980330, 0xcc5fbc49, 0x564988a5 },
+    { 0x276d449a, 0x9bdf135b, 0x95ede8f4 }, { 0xc32d9605, 0x5bc8abc5, 0x4e8fe15e },
+    { 0xbee42093, 0xedd508b1, 0xc8c3096b }, { 0x37dd1489, 0x139555e3, 0xad766f3e },
+    { 0x315e986a, 0xce71c06b, 0xba070d1f }, { 0xd32b5af7, 0x31f7cf41, 0x263d26a3 },
+    { 0x94340e79, 0xc0eaf01b, 0x10cd095a }, { 0xc5a81a10, 0xdb6c921d, 0x2ec71565 },
+    { 0xd0b0903a, 0xfcb1c877, 0x4054d0c0 }, { 0x4aee123e, 0x112ff9d9, 0x47595085 },
+    { 0x0d37dfbf, 0xa3b2a6b3, 0x4fda979d }, { 0x9221afdf, 0x701e7c19, 0x20bf7036 },
+    { 0x70ccb23d, 0x34f1c2f3, 0xe9b363e9 }, { 0x01d3a063, 0x99cb88bb, 0xf8350194 },
+    { 0xc8782e04, 0xc46cbfd5, 0xa5acb40b }, { 0x855bf276, 0x38d4fd8b, 0x81638935 },
+    { 0x47ef4ec0, 0x5011d833, 0xb4080251 }, { 0xab21ed59, 0x3a888fd5, 0x344233a6 },
+    { 0xc92e0c9c, 0x97d73fb1, 0xd7cd1640 }, { 0x9380bf21, 0x6eab3a25, 0xf23cebb2 },
+    { 0xc846530b, 0xcbd03f3f, 0x51706963 }, { 0xfe8f173b, 0x1fe29213, 0xe9aacd48 },
+    { 0x2fc72dd5, 0xe80738e1, 0xd27bed2f }, { 0xd6be2ab9, 0xc46c8d85, 0x0b92977b },
+    { 0x0e763640, 0x6665543b, 0x4a681437 }, { 0x25ab15da, 0x65ad0f13, 0x17dac0ad },
+    { 0x6064f402, 0xac7fc2a7, 0xd1fd698d }, { 0x533c850a, 0xefc11f37, 0x1e59f6d6 },
+    { 0x9bac7440, 0x34b9baed, 0x6364cc1e }, { 0x3172e8c4, 0x2791b35d, 0x4fce1be1 },
+    { 0x1cfaad59, 0x11715577, 0xfb27d310 }, { 0xfc224ff7, 0x15b072b5, 0x269bbd8d },
+    { 0x835a5062, 0x7f5ff231, 0x52472cc2 }, { 0x319ad8f3, 0x82939cd1, 0xf3f63c2b },
+    { 0x79010a64, 0x7d562005, 0xec4f635b }, { 0x8de750da, 0x34457735, 0x2bd044b2 },
+    { 0x1d832f56, 0x8e1edaf7, 0x81905c17 }, { 0xd0e57159, 0x65e94785, 0x128070dd },
+    { 0x7e633f56, 0x35291f53, 0x831f3cec }, { 0x65d8fa59, 0x4f751ec5, 0xeca98997 },
+    { 0x74e3a004, 0xda6536bb, 0x6c840a65 }, { 0x45cdc34c, 0x142506c5, 0x86bf0180 },
+    { 0x2658f82f, 0x98c060f3, 0xd3b25c41 }, { 0xbe3eef43, 0xf1128d4b, 0x901aed11 },
+    { 0x57543adb, 0x80558b49, 0xe0e1fb09 }, { 0x3b914543, 0x961d6a0f, 0x99e965e3 },
+    { 0x5a865f92, 0x97e53115, 0xa387ebb2 }, { 0x2c53e03b, 0xe99eb1d7, 0x47dfdce3 },
+    { 0x1e5b2e14, 0xc0b5ef31, 0x63261fdb }, { 0xd29d5cda, 0x77460a71, 0x5ab48670 },
+    { 0x69bca4cf, 0xb688db7d, 0xf737e3d8 }, { 0xe0004726, 0x2542690b, 0xf32d558e },
+    { 0x4b67e532, 0x3f598b4f, 0xec591a9a }, { 0x7b3989f2, 0xafcd1949, 0x129f3919 },
+    { 0x255ff563, 0xc1b657f7, 0x6ea7f879 }, { 0xb9d814c7, 0xc78de067, 0x17f99a86 },
+    { 0xf2c8dd7e, 0xc0d3dec7, 0x178a7c97 }, { 0x8c1827ae, 0x4b5fc1d1, 0xdcefc1d8 },
+    { 0xc7dc0ca9, 0x88320cc5, 0x3529abb1 }, { 0x6a996ffa, 0xcdf64525, 0x1846da22 },
+    { 0x054796e1, 0x27ba5f51, 0xdfbf2399 }, { 0x2b8b0473, 0x8280d0a3, 0x9396dcd4 },
+    { 0x91ee11b7, 0xaa90d745, 0x70e82d3f }, { 0x13dde910, 0x475d002f, 0x880905e0 },
+    { 0x7e9b89e7, 0x2d7626d5, 0x6aafa6bc }, { 0x2bc39285, 0x6ad71dc3, 0xeb34f273 },
+    { 0x98950208, 0x33a6b65f, 0xde96e808 }, { 0x3c7e998a, 0x63cf78c3, 0xa097ab83 },
+    { 0x326e8455, 0x0c1692f5, 0xe230768f }, { 0xbc7dd09a, 0x44c04bf1, 0xe5137ddd },
+    { 0x07239907, 0x59087433, 0x23f16090 }, { 0xefea6d25, 0x33a47fdb, 0xc07e0c16 },
+    { 0x775b0a14, 0x25d3eecf, 0x2ed4f10f }, { 0xa9e6ef71, 0xd6b633ef, 0xe179c58c },
+    { 0x6171475f, 0x53524e61, 0xde5547f3 }, { 0x55c14918, 0x55d94ad7, 0x8b8eb5eb },
+    { 0x137185b6, 0xbdef3f99, 0x16b86bf9 }, { 0x18e2de6a, 0x380ea30d, 0x1fa7f9b2 },
+    { 0xd5dbbab4, 0xb9abc8b9, 0x4748d916 }, { 0x2bff6a13, 0x036aa28f, 0x0debede5 },
+    { 0xff629c2a, 0xb16877f5, 0x45f2967e }, { 0xfaac4959, 0x1ed7cc59, 0xc47363ce },
+    { 0xa2ff86e3, 0x36b9e40f, 0xbaae2cec }, { 0xffd47c51, 0x6c050a15, 0xf0930ed8 },
+    { 0x63c61db9, 0x0d9eb88b, 0xa1d01593 }, { 0x902811e7, 0x387280f5, 0xd31323cb },
+    { 0x52695c4a, 0xfbe43fe7, 0xfa07c839 }, { 0x5b664832, 0xd4da1019, 0x3199b91c },
+    { 0xd6352cec, 0x12d8e02b, 0x7548b232 }, { 0x1f0f9293, 0x19fc6e05, 0x7ce140a7 },
+    { 0x65852685, 0xccc44b9b, 0x7ff99fca }, { 0x2403c021, 0x1dfd9821, 0x147535ab },
+    { 0x648e3409, 0x4fa55597, 0x3cd5939e }, { 0xd7b1544a, 0x5af1eca9, 0x565e59b3 },
+    { 0x13a8a3a8, 0xc9d9dd29, 0x1296bb0e }, { 0x01b1d130, 0x3fa2f295, 0x1c887c7d },
+    { 0xf1adb463, 0xeab87a07, 0x3d4ac74e }, { 0x29787c64, 0xdc8614af, 0x207c7995 },
+    { 0xf0b5848d, 0x2f1a36e1, 0x3d529edf }, { 0xf3350ee6, 0x469bc867, 0xd5e0dc51 },
+    { 0xc186edd8, 0x17b732f5, 0x5be9e668 }, { 0x790f08b9, 0x4f2bed97, 0xef24521a },
+    { 0x23ccbe68, 0x14d7f4ef, 0xb420ccec }, { 0x1850b298, 0xa1b9d9b9, 0x3983212c },
+    { 0xf2a38b0f, 0x685f9109, 0x057ce33b }, { 0x375694d1, 0x7195e05d, 0xecf3ab42 },
+    { 0x168c3d57, 0xb642e647, 0xb4e64064 }, { 0x0eb00d1a, 0xc2f28a83, 0x54bbc6cd },
+    { 0xf998b494, 0xd91fa9ef, 0xb6e2ace1 }, { 0xa4181d4e, 0xa9ad98ff, 0x3427d5be },
+    { 0xd330f19c, 0x2d437ac7, 0xfcb8d8e8 }, { 0x081bb4ef, 0x8dd537c9, 0x419bd11f },
+    { 0x9a3f696d, 0x5e3200e9, 0x6dc73f8c }, { 0xfea3a1a6, 0x78c118ed, 0x3eea92d6 },
+    { 0x38e033a2, 0xccef94e1, 0x3529b548 }, { 0x92b1f71e, 0x8ea8cdc7, 0x014fec89 },
+    { 0xde80a206, 0x363a6363, 0xd9b77e91 }, { 0x448d2f6a, 0x61cd2a8f, 0xb93f29cd },
+    { 0x419e097d, 0xd7ceef39, 0x1154568e }, { 0xfb52222c, 0xf6220e71, 0x0804808e },
+    { 0x3ad189f9, 0x3666fc9f, 0x02696828 }, { 0x65cb045e, 0x1d890b13, 0x52f18ddf },
+    { 0x6d268fad, 0x61157605, 0x21b914f8 }, { 0x8d393bfb, 0x8be15f2b, 0x00a670fd },
+    { 0x1e8765dd, 0xc00bce9f, 0x134994d0 }, { 0x5c92ede0, 0x9de31dab, 0x271592d4 },
+    { 0x9e462347, 0x9109754d, 0xe97be06c }, { 0x30ae45ce, 0x2fe4cb4f, 0x1093f2a4 },
+    { 0x6dfdf0d8, 0xe68a69a9, 0x50988f20 }, { 0xbd9a7b67, 0xd330611b, 0x4e80367e },
+    { 0xc88b92a7, 0x7a0c8e47, 0x4e8ce222 }, { 0xcd20ed23, 0xfd875955, 0xdb458657 },
+    { 0xb8ae0849, 0x10d7754b, 0x76be4b13 }, { 0xc714135e, 0x97df40cd, 0xe9eead0f },
+    { 0x1e15033b, 0x9bac9517, 0x0caa7739 }, { 0x5ce4d622, 0xf0b7eeb1, 0xf67a55dd },
+    { 0xa46cb04d, 0x881708ed, 0x7d7e2b52 }, { 0x9b5c6854, 0xaa905d69, 0x1ec28ea7 },
+    { 0x57795df8, 0x42b9b24f, 0x555c0c8b }, { 0x9cdf8154, 0xd28fc527, 0xd5ab819c },
+    { 0x4858170b, 0xf283cd71, 0x2cd07f0d }, { 0xe3f3da26, 0xf3cdf0dd, 0xbd4b29f3 },
+    { 0xaf433e08, 0x43e8e463, 0x05705ed0 }, { 0x735e5d20, 0xe82116af, 0xdccbef2c },
+    { 0x07461223, 0x493bac35, 0x9f5acf0b }, { 0x94d163f1, 0xccc13795, 0x651292a6 },
+    { 0xca142909, 0xe58430d7, 0xb7cacb42 }, { 0x4310e7a0, 0xadf4f35f, 0x343b9fc0 },
+    { 0xd2724dd9, 0x9aac6195, 0x672012c3 }, { 0x364b37dd, 0xba5ae2dd, 0xb0a54f95 },
+    { 0x16f3507f, 0xa84b4823, 0xa75c4e9c }, { 0x2bbdcc37, 0xee1d736d, 0x1faccff3 },
+    { 0xe4d90ad8, 0x155b90eb, 0xef78e264 }, { 0xf60f9f36, 0x636d3e3b, 0xb066d9d3 },
+    { 0xb5446491, 0x75fffff5, 0xc796c901 }, { 0xf45184a0, 0x5fe6999f, 0x1bdde21f },
+    { 0xaa04eba1, 0x3308f653, 0x44ad10b1 }, { 0x1f82282c, 0xada58031, 0xfcef2472 },
+    { 0xb6a5d77a, 0x5bac00c9, 0x13fb2cb6 }, { 0x18a4e584, 0x070f4767, 0x25e82a18 },
+    { 0x8ed54b31, 0x9dcf127b, 0x4d9d4b32 }, { 0x80f691b5, 0xa91e140b, 0x9bb5020a },
+    { 0x19db6e1d, 0x8992bebb, 0x0059d6c6 }, { 0x63a063aa, 0x8b800ec5, 0x937776d2 },
+    { 0x2865aa3b, 0x0227c019, 0x4c985ae6 }, { 0x0d954774, 0x7faa523f, 0x29712d8d },
+    { 0x1cdbd7f3, 0x33beff59, 0x7a2baec6 }, { 0x4c490bc1, 0x3e0d2a2f, 0xbfce4760 },
+    { 0x4e743cc3, 0xe748ee09, 0x12f954d5 }, { 0x2e3285d4, 0x464e20b1, 0x6c754f63 },
+    { 0x16783f6e, 0x45ddd4e5, 0x16cab6c9 }, { 0x7d4a53d6, 0xd9d47281, 0xf2581897 },
+    { 0x22d54390, 0x9528b967, 0xd79b9459 }, { 0xa2453a79, 0x7993d109, 0x4ec7b672 },
+    { 0xb1401fcb, 0x272bf487, 0x0a6d8de1 }, { 0xbc41e966, 0xc6bdc235, 0x6fde6a62 },
+    { 0xa782e352, 0x12e1764b, 0xeced3489 }, { 0x87b5c903, 0x60c6df77, 0xa445eec2 },
+    { 0x730d96b4, 0x9b1baaab, 0x6892c004 }, { 0x3f715c1f, 0xc9c1292b, 0xa18db2fd },
+    { 0x04aca8ee, 0xf4f5497d, 0xdcb6116f }, { 0xe2a42a3f, 0x3f936f19, 0x1ca2ae5c },
+    { 0x3d1fe967, 0x3fb53aef, 0x09f3e63a }, { 0xe3a60bb1, 0x775b5d75, 0x962c6c87 },
+    { 0x2dcf1725, 0x9083cc91, 0x8b4a31c7 }, { 0xfe6fc81c, 0x70bcd25b, 0xd983e392 },
+    { 0x3a38db1b, 0x7e0b9ccd, 0x50350eba }, { 0x7f394804, 0x2d271e0b, 0x19c1ce1c },
+    { 0x9d0d4e5b, 0xcc6500cb, 0x6a6126d3 }, { 0xd0c06031, 0x77b95dc3, 0xb91309d9 },
+    { 0xffee76cd, 0x61bb9d0d, 0xb3bb4226 }, { 0x7f17caa9, 0xc114d231, 0x00665554 },
+    { 0x66f5aedb, 0x508e7d57, 0x5f2ffc19 }, { 0xf3b2689a, 0x8e630e11, 0x0a4c51f6 },
+    { 0x187210ef, 0xe1b560a5, 0x09adb2b1 }, { 0x31ea0b74, 0x8392e9e7, 0x5e221361 },
+    { 0x8d34ec5a, 0xf9f99a23, 0x62b647c1 }, { 0x34acc91e, 0xc8afb92b, 0xd862a6f0 },
+    { 0xa729af8f, 0xa4533aab, 0x6b27c19d }, { 0x01f41449, 0x114c5733, 0x8871d9c6 },
+    { 0xf8636c55, 0x67e55c7f, 0xf5f2f9d0 }, { 0xa3f23bba, 0xa526d6b7, 0x9c1f4366 },
+    { 0x24dbe07b, 0x2c0f2b53, 0xd6e908e8 }, { 0x380edf7f, 0xf661db01, 0xb9621a58 },
+    { 0x3c5bc97c, 0x45ccad67, 0xb879e027 }, { 0x6e1ff635, 0xbb7efc6f, 0x34209395 },
+    { 0x9da9ad33, 0xe2b5c0bf, 0x68199227 }, { 0xba54f4b8, 0xbbcd0307, 0x95119304 },
+    { 0x71e3b7ff, 0xb85cd0d3, 0x051bfe82 }, { 0xaed1eac4, 0xbd0973f3, 0x734a9abb },
+    { 0xcceefb04, 0xe137209b, 0x2ef53513 }, { 0x7cf89851, 0x163e2c85, 0x163b33b1 },
+    { 0x4f440ef2, 0x949dbe61, 0x8f8950fd }, { 0xd2833183, 0x26b0de61, 0xcfcf4b69 },
+    { 0xb195cfd8, 0x0bc1645b, 0x9a74771c }, { 0x5f7f2a55, 0xd6a384fb, 0xa2465c72 },
+    { 0xb7c0128c, 0xf1f0a2c1, 0x230ebd24 }, { 0x12a352f9, 0x1beab185, 0xddae019e },
+    { 0x4d771c48, 0xda407261, 0xa90d1cb0 }, { 0xc7724614, 0xbbb59ad7, 0x866c4566 },
+    { 0xc0cd42b5, 0x8290dd37, 0x2b875e4d }, { 0x0cc8f81c, 0x56abd2df, 0xaeeea633 },
+    { 0x79a931fb, 0xaabf4371, 0x862eca1d }, { 0x14faae01, 0xcb7b23af, 0x7330c62b },
+    { 0x1b06a943, 0x96b4952b, 0xd8d193a6 }, { 0x79374e3c, 0xca4e9abb, 0x0020789b },
+    { 0x9a7769d1, 0x24c99e4b, 0xe50a6290 }, { 0xc923f140, 0xc6379b15, 0xe823ec0a },
+    { 0x59cc052b, 0x519908af, 0x6efdc58d }, { 0xe1fb8a9d, 0x89fbe1ab, 0x259b7331 },
+    { 0xb6d51bbb, 0x68de095b, 0x45d0b121 }, { 0x9953f433, 0xbe1945a7, 0x5760c15b },
+    { 0xb880e6c9, 0x614a0bbb, 0xd7bf3bae }, { 0x372d0bef, 0x9c6bfe33, 0x380b71a8 },
+    { 0x00a3e8d9, 0x80885531, 0xdc58f0f4 }, { 0xc771edb9, 0xe0d58c6d, 0xe33602c2 },
+    { 0x69d08360, 0xe5cd19b5, 0xce978226 }, { 0x8c55dffc, 0x185e90a9, 0xa7ecc3c3 },
+    { 0x40c276f3, 0x34abcb61, 0xb8c24fe8 }, { 0xcfb34c46, 0xf355f96d, 0x38bbc045 },
+    { 0xe53e72ca, 0x5d539257, 0x046a284d }, { 0x679b5c07, 0x56e1f399, 0x33be2d3e },
+    { 0xec3aaf12, 0xa615dc61, 0x24886013 }, { 0xe944fa9e, 0x90d9ba3d, 0x06042ba5 },
+    { 0x20b65ff8, 0x8481828b, 0x56040453 }, { 0xe257969f, 0xb503ce43, 0x845df8a8 },
+    { 0x845bfbb6, 0x817815d7, 0x22a10e2e }, { 0xb86233d3, 0x873ba253, 0x787d3996 },
+    { 0x6f01c690, 0x1caa7e0b, 0xb54ea148 }, { 0x95337c88, 0x37a87899, 0xc10287a6 },
+    { 0xdef0128a, 0xf66b7951, 0x375cf0da }, { 0x3655a496, 0x5dd866a7, 0xee5eafcd },
+    { 0x463c9940, 0x0ac5a447, 0xc3005aef }, { 0x95805728, 0x03e93123, 0xf19d0e46 },
+    { 0xbaeebf4a, 0x13bb70cb, 0x60e7b0ba }, { 0x2478b4bd, 0xee718a6d, 0x82985a98 },
+    { 0x5cce17b9, 0xf05b6131, 0x9c628e96 }, { 0x5f47e24f, 0x707f4411, 0xceec22a6 },
+    { 0x83ef44d5, 0x4901ef07, 0x78c34063 }, { 0x53e37544, 0x8b870701, 0x114c2647 },
+    { 0x6e247701, 0xcc8fe963, 0x31daa0af }, { 0xe7d298e1, 0x0c6dcdb1, 0x6bdd0326 },
+    { 0xd2b8c0e6, 0xb487dd11, 0xf993b370 }, { 0x8a7e22d9, 0x5b57fb4d, 0x2464693b },
+    { 0xdba7297c, 0xd02205bf, 0x645581f9 }, { 0xa98e62ca, 0xfb7a1571, 0x41c40919 },
+    { 0x7d53d2fc, 0x5a0da2e7, 0x462b61f3 }, { 0x5e0e955d, 0x98862e35, 0x7c480309 },
+    { 0x217132be, 0x812fb085, 0x9d02b6e1 }, { 0xdf45f69e, 0x6767d239, 0xe973de11 },
+    { 0x076a942c, 0x745adb3b, 0x1e4f36dd }, { 0xf1418979, 0x6e54e9b7, 0x06f0d013 },
+    { 0xb8afe708, 0xbf1dc1db, 0x4a58c6d5 }, { 0xe6528801, 0x50db91db, 0xf4c668be },
+    { 0xc716c96f, 0xe76444f9, 0x7ec08221 }, { 0xeeeb7eca, 0x6e5b969b, 0x6a0c396b },
+    { 0x5d8133f0, 0x07aba3b7, 0xc00e4e30 }, { 0x9b3df48e, 0xada4fb43, 0xea2a3a96 },
+    { 0x82653601, 0x495720d7, 0x5d0497aa }, { 0x9df9c5cf, 0x3efdc689, 0x926b4fda },
+    { 0x99981e66, 0xeec77dcd, 0xd688716e }, { 0x2aff32b0, 0x573ada8b, 0x634466ea },
+    { 0x3974f68e, 0x39198f5f, 0x613ab5c3 }, { 0xf843357a, 0xb65efdb7, 0x49f72bd8 },
+    { 0xe413b96e, 0xe812d91d, 0xafb10bed }, { 0x0fe73a64, 0x59b4a595, 0xc6173da3 },
+    { 0x2caff611, 0xa85bdc0d, 0x639af0c8 }, { 0x52514872, 0x7c9f5907, 0x10f853c3 },
+    { 0xb9ef9409, 0x4b1360b3, 0x815de72a }, { 0x871fcae3, 0x7ca14713, 0x2efef7b8 },
+    { 0x397ea065, 0x9b6f2e09, 0x7daa1478 }, { 0x8cf02cb4, 0x34fb9763, 0xc3a7cbfb },
+    { 0x6f5e0463, 0x534f3fcd, 0xbac657a7 }, { 0x4e0cb373, 0xd221c239, 0xd916f315 },
+    { 0x2206e2b2, 0x261ba391, 0x04ec797e }, { 0x5ac98a2e, 0xf0485ab7, 0xc5b39816 },
+    { 0x3df5c62b, 0xaa804b75, 0x6c44b755 }, { 0xef9c14d2, 0xde6b7bdb, 0x382da2eb },
+    { 0x2ed67f1c, 0x40015961, 0xb65e8764 }, { 0x3acd571e, 0xe594d41d, 0x2edb03e5 },
+    { 0xd809b2e9, 0xe1c66c17, 0xf6b81406 }, { 0x8cdb8810, 0x40340237, 0x6e3db143 },
+    { 0xea6a9983, 0xe8ab2f5b, 0x6cfe9dd3 }, { 0x03f1e434, 0xe01f4bff, 0x0428c750 },
+    { 0xe25a047c, 0xbbff5403, 0x285b9dbd }, { 0xcf8a5aec, 0xd824e6bb, 0xcd399da3 },
+    { 0xf634eedd, 0xcd922d0d, 0xa97b311a }, { 0xe404af5d, 0x0e4b21a9, 0xa4c64f41 },
+    { 0xc55c94b2, 0x7be3b145, 0x9528d621 }, { 0x7834faf9, 0x34ce6527, 0x65d11016 },
+    { 0xbaf160f3, 0x0180ae95, 0xf9e41faf }, { 0x02b7b824, 0x19125c37, 0x55fb3963 },
+    { 0xa3716ee2, 0xb87f77e5, 0xf24ba01a }, { 0x381d24b6, 0x76b91f2f, 0x6349a345 },
+    { 0x03b2d67e, 0x706c44e7, 0x33faad86 }, { 0xf9d3ffc1, 0x76d52207, 0xd623776a },
+    { 0x47318376, 0xcb9be147, 0x38ce9cbd }, { 0xba9b7f4a, 0xfacea17b, 0xcc2c97b8 },
+    { 0xd37e68cd, 0xcec18e55, 0x83758439 }, { 0x5a7ea26c, 0x77d9fe4f, 0x22b2e51a },
+    { 0xdfb2eb02, 0x74d06e7b, 0x4ceefedf }, { 0xbddd43f6, 0x11fb29bf, 0xfeb55750 },
+    { 0xed361a82, 0x3b74b22f, 0x1db6e24a }, { 0x2a62b374, 0x039af26b, 0x61a48c98 },
+    { 0xc3e80fa9, 0x2e56a6fb, 0x01487ed3 }, { 0x8d4e2191, 0xdb286af9, 0xa974db6d },
+    { 0xb6f780ce, 0x2630774d, 0x5fa66b85 }, { 0xb6de5234, 0x9fe67af9, 0x5045c870 },
+    { 0xb14050a4, 0x58616fef, 0x277536ca }, { 0x4463b3cb, 0xf069047f, 0x4660b83d },
+    { 0x9ff46684, 0x8d59c66d, 0x8e34d54d }, { 0x6f4fed5a, 0xad1264ff, 0x55b535cd },
+    { 0x6add310b, 0xda6fb645, 0xc2c13e90 }, { 0x79740e1a, 0xdd50e75d, 0x00153b94 },
+    { 0x8108af19, 0x0630389f, 0x08c8cd8e }, { 0xee327531, 0x7a476eef, 0x766845e9 },
+    { 0xf2f0d702, 0x5a4b1c57, 0x57859855 }, { 0x26e5f21a, 0xdfb1b9c5, 0x557b4222 },
+    { 0xfadb8665, 0x3641c0ab, 0x48a60d16 }, { 0xc24fb262, 0x5d7cce59, 0xdc084482 },
+    { 0x7e4a675f, 0xdc13cdcf, 0x6b9b9910 }, { 0x1f032f09, 0x4000d9c9, 0xebb9af6e },
+    { 0xd5a6353b, 0x05286761, 0x1a230840 }, { 0xe302e21d, 0x64fd12e7, 0x5eb4e010 },
+    { 0x818caeac, 0x564fcafb, 0xc589bfdc }, { 0xbb67c7b5, 0xa95002bb, 0xa640ad97 },
+    { 0x24bb0fae, 0x4b877427, 0xd41bfd7f }, { 0x964773ef, 0xca891a35, 0x626d4e26 },
+    { 0xe679f292, 0xf04065c7, 0x087796a1 }, { 0xbfa70997, 0x7de6e6d1, 0x40943eac },
+    { 0x1ef3db5d, 0xb51d1d65, 0xf7c091c2 }, { 0x036e948f, 0x9786cfdf, 0x675d2684 },
+    { 0xafc3e48a, 0x61ab8663, 0xae7aea20 }, { 0x837feb86, 0xbdb5fa09, 0x03038aed },
+    { 0xb7d17d26, 0x7edb2a7b, 0xcb20e2a1 }, { 0xcfbc74f8, 0x80ea6fe5, 0x9c25e5b9 },
+    { 0xa1ec72ac, 0xb4c9ea79, 0xa7b5f543 }, { 0x54e39eb9, 0x1bd1ec45, 0x27d4be20 },
+    { 0x05b866ef, 0x1e80f9ed, 0xf8763bec }, { 0x083fae23, 0x0c4b4907, 0x79b729ce },
+    { 0x83d68d58, 0x71c76557, 0x873e19e2 }, { 0xd28d413b, 0x829569a3, 0xf7c3d2c2 },
+    { 0x747fb673, 0x60864775, 0x6b4692fc }, { 0x4b13148e, 0xd3aa749b, 0x093e0ada },
+    { 0xd1edc370, 0x7c461e5f, 0x101df8de }, { 0x87235492, 0x4c44665b, 0xde520b1b },
+    { 0x0cca74e2, 0xfbb05097, 0x31fb5fa9 }, { 0x511ed5bc, 0x4878bfab, 0xd08e2bc6 },
+    { 0x987d2b37, 0x45db181d, 0x692fd032 }, { 0xfbf4a502, 0xf73cea65, 0xa19c7f0e },
+    { 0x793f11c9, 0x3613f323, 0x0771c988 }, { 0x7e3f10f8, 0x910fe9a5, 0x1c3d086d },
+    { 0xa6506099, 0x029d469f, 0xd3816e6b }, { 0x6faf7bb1, 0x38d6f495, 0x75627631 },
+    { 0x400d6683, 0xd3466cdd, 0xedaf604f }, { 0xd1e8e758, 0xe843afd1, 0x18653f2e },
+    { 0xc551dd10, 0x286dc807, 0x54e3a0a9 }, { 0x8d637d24, 0xd15c0dbd, 0x33cc6470 },
+    { 0xccf19146, 0xc75f34a3, 0x7d0c101c }, { 0x2a0d0eb9, 0xa733afcb, 0x353d6c74 },
+    { 0x38447746, 0xd38bfef3, 0xd8af826c }, { 0x9b87a7c4, 0x1fd7253d, 0xb6f2c5ee },
+    { 0x86f96aa4, 0xe96483a5, 0x6c10e087 }, { 0xe16efac5, 0xbcc16493, 0x4cdfdd2d },
+    { 0x210ecf13, 0x302afffb, 0x36f541d5 }, { 0xffc3f7f8, 0x5029cb41, 0xecabbf58 },
+    { 0x419979e8, 0x92f70b81, 0x92f03b1a }, { 0x4b96dc5e, 0x4dee569f, 0xb3d2859d },
+    { 0x4f8fdbd2, 0x6ce69ab7, 0xefadf241 }, { 0x0b3cec82, 0xffbe1f55, 0x6ace83fc },
+    { 0x8cd1bc2a, 0x261d1ccb, 0xec536153 }, { 0xc1210517, 0x60afa05b, 0x65dcf82a },
+    { 0x66eed360, 0x50245671, 0x8eb77c3b }, { 0xd8734af5, 0x515d9e9f, 0x0779385d },
+    { 0xcef9219b, 0xb2cc4d73, 0x22faa5f2 }, { 0x907d1fd3, 0xc0e346d3, 0x549f67cd },
+    { 0xbd919e3c, 0x404183d7, 0xc10592e5 }, { 0x80332edc, 0xe855b511, 0x6b04c5c1 },
+    { 0x20c21f58, 0xed304af1, 0x9c846002 }, { 0x4a986534, 0x429901a5, 0xdb53fee9 },
+    { 0x3a0e3351, 0xac52abeb, 0xfa4682fc }, { 0x81f7ec2a, 0x4345d4b5, 0xe4f32911 },
+    { 0xf9bfdb97, 0x401fdc5f, 0x18fd8dec }, { 0x9967fe9b, 0x4c323911, 0x2318f205 },
+    { 0xaefa170b, 0xa350530d, 0xb1159a45 }, { 0x585253cd, 0x9d712b6b, 0x0e0a6096 },
+    { 0x70ae9996, 0xa4e03215, 0x7cadc637 }, { 0xa38f1331, 0xe0156639, 0x2a253a2d },
+    { 0xe85fb013, 0xfed2be71, 0x148bd0d3 }, { 0x86dc18d5, 0xe096d2bb, 0x574ee456 },
+    { 0xeeb6d1f6, 0xcccecbb3, 0x1239d919 }, { 0x5719d4ed, 0x258164d5, 0x808816af },
+    { 0xcc41aee6, 0x34742ee7, 0x4bacf915 }, { 0xb6419561, 0xfb0bde37, 0xcc72005c },
+    { 0x1017a37c, 0x171fee83, 0x63845d27 }, { 0xf15163cc, 0x4f447c63, 0x80cd2dc1 },
+    { 0x58304557, 0xd0d0d879, 0x843d68d0 }, { 0x527487b3, 0xc079cd8b, 0xa3385e1e },
+    { 0x6284bcdf, 0x3b6baad9, 0x62e21d0b }, { 0x26b295fa, 0x1213715f, 0xaa2490e2 },
+    { 0x6aaef911, 0x6e6cf6a7, 0x60851cb2 }, { 0xded23bfa, 0x25c857cf, 0xfb4b784c },
+    { 0x57042140, 0x36e82389, 0xcfc7dbe5 }, { 0xa307d979, 0xe9af8c9d, 0x83622047 },
+    { 0xfe542b06, 0x94d417b1, 0xb088cc98 }, { 0xb9b1aba0, 0x15a7e11f, 0x5a907f16 },
+    { 0xdd428b67, 0x77d5f4fd, 0x1975ee48 }, { 0x19587421, 0x8360e2c9, 0x1a12e32c },
+    { 0xa14ed6ab, 0x1aee8ebb, 0x055ad4b9 }, { 0xf337dfdc, 0x8e7ad459, 0x6058151a },
+    { 0xfa8fe23b, 0xf8ba5733, 0x06094d0a }, { 0xd1ac9e86, 0xbb6e5ccd, 0x1f3329b4 },
+    { 0xa527cce4, 0x60996545, 0x334b06cb }, { 0x7564eff5, 0x4e41627f, 0x85440463 },
+    { 0x0ad0169a, 0x3c109fe3, 0xa16c584d }, { 0x0943cc3c, 0x5cdbc845, 0xced9765c },
+    { 0x6122ae6b, 0xc0b44afd, 0xc5647aca }, { 0xc49387d7, 0x6ac6005b, 0x2c4f4d2b },
+    { 0x0c81e389, 0x6dbabbaf, 0xdf2b5fc1 }, { 0x604f77ac, 0x817999ab, 0x51f82333 },
+    { 0x105e8001, 0x61e19ef7, 0x90ab14e6 }, { 0x6130f9a1, 0x93cfde0f, 0x8e011435 },
+    { 0xf87237a1, 0x3148daa7, 0x39b1198c }, { 0x2264170f, 0xe002b9cd, 0x009d7377 },
+    { 0x86599e98, 0xe78ec711, 0xa2d35472 }, { 0x46578a97, 0x1bac39f5, 0x1dd25aa5 },
+    { 0x97a3c64a, 0x12bbb891, 0x39d7bcca }, { 0xcaef6339, 0xa04fe3e1, 0xcc24ad67 },
+    { 0xab76adff, 0xd0269851, 0xddc9f5c3 }, { 0x3442ffaf, 0x25a35871, 0xc91f3ecb },
+    { 0xd93ee41c, 0xdc9d3109, 0xb8263314 }, { 0x5a525f22, 0x21d26151, 0x417ab991 },
+    { 0x38653175, 0xbc0520d7, 0xb03a88c5 }, { 0x9fe04809, 0x391b2acf, 0x2a134c86 },
+    { 0xe5c2bec3, 0x4154142b, 0x2a10f7de }, { 0x886c82db, 0x4980ce17, 0x24aa914d },
+    { 0x71ac89b4, 0x0cfd591f, 0x064e6366 }, { 0xbd790c73, 0x338c0087, 0x608c1740 },
+    { 0x62d3864f, 0xbb49133f, 0x648ee113 }, { 0xa6f766a2, 0xcdeccf85, 0xb97921d1 },
+    { 0x5fc7b45f, 0xe748076b, 0xc2aced92 }, { 0xec2f8414, 0x64fe4da5, 0xd462e914 },
+    { 0x1e7e048b, 0xda15733d, 0x7ef3a78d }, { 0x166f8a95, 0x87f82357, 0x6b9306b8 },
+    { 0x2f6f2d2a, 0xf0f0212b, 0x3d3f731a }, { 0x798a69b5, 0x087b81c3, 0xbc56bba4 },
+    { 0x63f0e6ff, 0x7b5a6e33, 0x514461ca }, { 0xf781dd4d, 0x76bf3983, 0x91a5e6af },
+    { 0xcf422b35, 0x5116ab99, 0x4f18e255 }, { 0xae33e8bc, 0x73083141, 0x43bac5e2 },
+    { 0xd2d0a5d4, 0x574c06ff, 0xaa18fabb }, { 0xb0a8d4b7, 0x50e56757, 0xdbc328d8 },
+    { 0xd5a98289, 0x8b41dbef, 0x4e911f81 }, { 0xae791ec5, 0xd4501e23, 0xae6118cb },
+    { 0x71fe69e1, 0xf39118e7, 0x449d4ebb }, { 0x018eb956, 0x24fb5ea7, 0x2b66bd84 },
+    { 0xfbb87498, 0x705fa523, 0x516537d1 }, { 0x152369a2, 0xd90d51b1, 0x9b3ad2ee },
+    { 0x392ff631, 0x4660f463, 0xdbfe7b52 }, { 0xe906395b, 0x746751a1, 0xe600ec47 },
+    { 0x5e31d8a0, 0x90b9dc81, 0x239b4ee6 }, { 0x1b351a99, 0xabb4ae07, 0x09c90a7f },
+    { 0xe284574c, 0xb19a9985, 0xccc47761 }, { 0x96c008a5, 0xe2c9694f, 0xb739487b },
+    { 0xe8b64c88, 0xe6bf5027, 0x1da67bb8 }, { 0xd09da8d9, 0x2056c251, 0x8ac488b6 },
+    { 0x1757e3f9, 0x8e1d8b07, 0x4f8151b2 }, { 0x02ec1ebe, 0xb8e6da21, 0x46941628 },
+    { 0x5d5029c2, 0x53e30651, 0x47631ec5 }, { 0xa4439cd5, 0x137d3a95, 0x3333d809 },
+    { 0xf771c789, 0xcfc13bf1, 0xeccf7cd8 }, { 0xde39947b, 0x35ec12e1, 0x9dce9a56 },
+    { 0xd2050f18, 0xb5165455, 0xbe175607 }, { 0xaa3b2b1d, 0x294c04af, 0x8fb09dda },
+    { 0xc6293a22, 0x8ae58a9f, 0xd5f44db5 }, { 0xb4b24041, 0xccf15ddf, 0x381de617 },
+    { 0x1cef8357, 0x5292d487, 0xe00fc1fb }, { 0xa858d8a9, 0x22bc68ff, 0x39b3590e },
+    { 0xcb9c75ab, 0xe4a4163d, 0xea4b0545 }, { 0xaeeed852, 0x8e70546d, 0x56e7c5fe },
+    { 0x94206335, 0xcec8ce95, 0xb0574c9a }, { 0x29201e81, 0xbddbc581, 0xf0f3fdbf },
+    { 0x8373d830, 0xe062c143, 0xe1ae7ec8 }, { 0xf45cac42, 0x08142c3d, 0x36bba00c },
+    { 0xd3e9b040, 0xc098f74b, 0xcf367ff6 }, { 0x8071618f, 0x76bf4cad, 0x44fddd8e },
+    { 0x775f653d, 0x7ce11d99, 0x1425925e }, { 0x46a8f793, 0xe2714bd5, 0xe5290c6d },
+    { 0xa4a363bb, 0xcb7369e9, 0x7a1946a6 }, { 0xd60cfc36, 0x0ed7c1fb, 0xc495d1c4 },
+    { 0x735ff6cd, 0xcfcb8211, 0x4050873b }, { 0xc7a6dbd5, 0x2f72cedf, 0x35b35d88 },
+    { 0x78803cb2, 0x634b10f9, 0x2e5e0d22 }, { 0x802df37b, 0x13119737, 0x4e318ebb },
+    { 0xe6e8add1, 0xae1e1c23, 0x67335acc }, { 0x176f5316, 0x9efc8851, 0x518daa5d },
+    { 0xa5ccc305, 0xb52ceb1f, 0x1f5faba7 }, { 0xbf5f30ca, 0xbff7f3af, 0x1970efac },
+    { 0xd979c3cf, 0x0e09afbf, 0xa844b562 }, { 0x08252467, 0x909e72b7, 0x23c078d7 },
+    { 0x9fdf4137, 0x32046447, 0x9953a13e }, { 0xccb7b888, 0xd7462265, 0x3c9accaf },
+    { 0x6d008703, 0x8c503ca1, 0x71acc97f }, { 0xd1b7eb80, 0xf9e4f01f, 0x8feb6dfe },
+    { 0xd1e1fc85, 0xdb4fc8a7, 0xce733140 }, { 0x4553605c, 0x81f53b49, 0xb77823dc },
+    { 0x127709a2, 0xaa072057, 0x18e03078 }, { 0xed6f4dfe, 0x2e4b6e83, 0x473d06e9 },
+    { 0x675e18ae, 0xd53db217, 0xcac5f5ef }, { 0x436bb209, 0xab031a67, 0x9479920c },
+    { 0x064b4c48, 0x208fe15b, 0xb8ad6184 }, { 0xd8623be1, 0xdf3e2893, 0x4cfb24f8 },
+    { 0xde6d6c43, 0xd4a1a4fb, 0x7cf477a5 }, { 0x3822aeba, 0x1dd804bd, 0x88783476 },
+    { 0xab147dba, 0x7bec9e2f, 0x6a3aa9a4 }, { 0xc85ec5c2, 0x6b1c9baf, 0xe83174e6 },
+    { 0x73599fa6, 0x5e623ac9, 0x5e6b9631 }, { 0x26aa6ede, 0x3661466f, 0x2acff46d },
+    { 0x9d2edc2f, 0xcc9d92fd, 0x92c0da05 }, { 0x3b942e4f, 0xaccf573d, 0xe7a3700b },
+    { 0xa9d16cee, 0xf8562be3, 0x226dbb1f }, { 0x1ce95534, 0xf8dc1be1, 0x60aa0909 },
+    { 0xcca23311, 0x60a370f3, 0x16198834 }, { 0xc9a18a70, 0x32612907, 0xdb628509 },
+    { 0xeb792fa4, 0xd9daa201, 0xa366dba2 }, { 0x7b404fe9, 0xd1c39c79, 0x1eaac7db },
+    { 0x0ed3fe28, 0xbe8287c3, 0xa5b36d6e }, { 0x0e926502, 0x63e8315b, 0xd0cc641b },
+    { 0x575548ee, 0x3a4e9657, 0xc017a590 }, { 0x16636d79, 0x57cdd9f3, 0xfc18bf3f },
+    { 0xb4dcb31f, 0xce21b2a7, 0xa07ae4d7 }, { 0x734a244f, 0xcf17157d, 0x5026cd30 },
+    { 0xea9605a4, 0x36d9e7d1, 0x73f1ed2b }, { 0x2ea6bdb3, 0xe0dc9b61, 0xf7faaacb },
+    { 0x85dab41c, 0x64487725, 0x85d6228b }, { 0xdf4c19a0, 0x34673d53, 0xcd82cad6 },
+    { 0x947ae938, 0x76f9850f, 0xf4df3094 }, { 0xa0ed2933, 0xd983d52b, 0xace286cf },
+    { 0x87cb4ae3, 0xb9997d13, 0xe3dfb633 }, { 0xd34a20fd, 0xb454f0af, 0x9bf756c0 },
+    { 0xe2ab2328, 0x1b3d37e9, 0x5b14c857 }, { 0x8cdb2b75, 0x6794d451, 0x70ec5fda },
+    { 0xfcb993c2, 0xa79a7581, 0xbb8d17d2 }, { 0xe2218986, 0xe959455d, 0x2bcdcd3f },
+    { 0xfc920af5, 0x9110f5ef, 0xe35f5483 }, { 0x1006af56, 0x5db17cd7, 0x5dda028d },
+    { 0x3ee87d76, 0x6e065d4f, 0xc299d625 }, { 0x29d07991, 0x4b795d7f, 0x08c070f7 },
+    { 0xc1d363ff, 0xf8c1ffa3, 0x0f4dedec }, { 0x247b2362, 0x3c18e2f3, 0xc6011882 },
+    { 0xc452c785, 0x27147a99, 0x0aee4d1e }, { 0xad9f6ff2, 0xc34eaffd, 0xec047c3e },
+    { 0x699888b5, 0xa63d967f, 0x42d90baf }, { 0x3d8bfc09, 0xdfad249b, 0xde83fdba },
+    { 0xaca0b90e, 0x7bf5785d, 0x47867ea2 }, { 0x8aa07fde, 0x4e33da3f, 0x026e0a9d },
+    { 0xa0fd353e, 0x5eb52a25, 0x4c20c838 }, { 0x1b2b3f63, 0xc01d495b, 0x81617507 },
+    { 0xe2290f53, 0x268a12c5, 0x0adcbe63 }, { 0x4b033f6b, 0x1cb07c61, 0xc1e6e2c9 },
+    { 0x53ed6914, 0x490c2d8d, 0x1af4c254 }, { 0xede7fabe, 0x002316d7, 0xf441826a },
+    { 0x9bd74163, 0xb9b6799b, 0x9aca06a4 }, { 0x7177ee7a, 0x564fa7e1, 0x958fe1a7 },
+    { 0x6157736a, 0x79a7ea95, 0x9efe1479 }, { 0x6432056a, 0xda2510ef, 0xc21583b0 },
+    { 0x83a1df45, 0xe1c7253b, 0x064e159d }, { 0x51fc33b9, 0x8967d1d7, 0xe7443dbb },
+    { 0xe375767b, 0x5aab7967, 0xd1eb77ae }, { 0x6dcc04e4, 0x50c4268b, 0x544d374a },
+    { 0xd95bcd60, 0xb6a0d71b, 0xec23f4a0 }, { 0x2c3e2b8e, 0x74eacd95, 0xa4dfe91d },
+    { 0x8a644072, 0xdbb87b7f, 0xf3711f6b }, { 0x19e326b2, 0x14c91fc1, 0xbf13d242 },
+    { 0x8db35557, 0xe2753095, 0x5afa4946 }, { 0xab46104f, 0x572fda39, 0x35cc608e },
+    { 0xa57748e2, 0x8641767b, 0x089cd228 }, { 0x3e8f83b1, 0xa36a459b, 0x62bbdc3f },
+    { 0x272c61ad, 0xbced2821, 0xc8fa99d2 }, { 0xa4bd9f3b, 0x7d9e29f1, 0x569dcc95 },
+    { 0xaa6d1733, 0x3c09e10b, 0x0787c727 }, { 0x46b4a6e1, 0x29cb10ff, 0x342dfe7a },
+    { 0xc7d5a159, 0x6f7fdf35, 0xed053925 }, { 0x0a2e4a3d, 0xea44be1d, 0x94584c2c },
+    { 0x278b716c, 0x4b7aba39, 0x281d8ef2 }, { 0xf1cd85c2, 0x8524ca65, 0x45dd09ad },
+    { 0x45741be8, 0x6722e49d, 0x1031f054 }, { 0x8655a8dd, 0x313f6477, 0x0497e53d },
+    { 0x6a955dc7, 0x866dfabb, 0xd6072580 }, { 0xab6e2b48, 0x00f8086d, 0xb47eeaff },
+    { 0x2e328f89, 0xdefb6cbf, 0x1a2cf6e9 }, { 0x110e611c, 0xb2215509, 0x8bd7e90f },
+    { 0xc9a8c938, 0xb434ab75, 0xade54293 }, { 0xa2147d3c, 0xdf3a7d1b, 0x80e840da },
+    { 0x130ac06a, 0xae0272f9, 0xd0088db2 }, { 0x0548163a, 0x73b3f963, 0xd74e1270 },
+    { 0xb97364c2, 0x5e722cb3, 0x25bd7088 }, { 0x95f86dad, 0x42ce26a7, 0xb3b4e0a4 },
+    { 0x3359462f, 0xf29d8a9f, 0x93fee0f6 }, { 0x43ae5810, 0x13720d9d, 0x06d0fb8a },
+    { 0x831459dd, 0xcbc5b543, 0x75a9c826 }, { 0xfbb73f44, 0x91008d21, 0xb77f6520 },
+    { 0xcf404ece, 0x25eb4939, 0x0cdf81b9 }, { 0xeb8a27ca, 0x9e52b11f, 0xdb47c165 },
+    { 0xc5a722e1, 0xbe23c6dd, 0xa453ed4e }, { 0x97e56cf5, 0xdce49fe9, 0x92545dce },
+    { 0x7e059e8c, 0x27ec0959, 0x0a8e93ea }, { 0x48195c6f, 0xa091508b, 0x3628cdc9 },
+    { 0x38c3d233, 0xe91f9283, 0x61ba6a8f }, { 0x05ba2d4e, 0x24f5a045, 0xab25876c },
+    { 0x88510a14, 0xd197af53, 0x72e512cd }, { 0x4cd2a95b, 0xae297d75, 0xbb0927e1 },
+    { 0x8c77653a, 0x5a961971, 0x91964550 }, { 0xa603be64, 0x7197ea2d, 0xccc7aac6 },
+    { 0xe5c8fe1a, 0xcdd96b43, 0xacb900cd }, { 0xd9013e84, 0xd3a27427, 0x9dee94e9 },
+    { 0xa889b0b5, 0xeb9cbb25, 0xefbdc93d }, { 0x551a2f8d, 0x82e05ee1, 0x515e31e8 },
+    { 0x1aad9921, 0xfc90e5c1, 0x5078302b }, { 0x8e6ff5db, 0xf6177785, 0xe27ca246 },
+    { 0x5665c275, 0x6f5c819f, 0xd4625d79 }, { 0x2920dd73, 0x03a965ab, 0x1f7b6938 },
+    { 0xe9ef762b, 0x56ee21c1, 0xc39acb13 }, { 0x785e55c9, 0x744df335, 0x55eb72b0 },
+    { 0x44729ca0, 0xb5ab36b3, 0x2a4b1fde }, { 0xa5cf7d46, 0x147dec7d, 0x79cedf4f },
+    { 0x1c1ad454, 0x87af560d, 0x250249bc }, { 0xeabe3785, 0x95b89e0f, 0xaa74b6fc },
+    { 0xabe81796, 0x3cd3b383, 0x5ff321cf }, { 0xfe072a3f, 0xc01162b7, 0x41322a27 },
+    { 0x7279de99, 0x6bda192f, 0x9f36efec }, { 0xdafce49e, 0xa2fce78b, 0x491c28df },
+    { 0xe845738a, 0xd053a3f5, 0x5270f753 }, { 0x0e47d23f, 0x75ab9e85, 0x6006b3a5 },
+    { 0x8d62480d, 0xa555b57b, 0x139f9206 }, { 0x26c72ea9, 0x83b60e47, 0x491fdf14 },
+    { 0x91c03f24, 0x1d23806d, 0xeb5d3ce4 }, { 0x6591a6da, 0x3ec38833, 0x5a4fbf48 },
+    { 0xfd0d3e31, 0xdd397ac7, 0x2426ff51 }, { 0x5b1eff69, 0x5870226f, 0x191ffb18 },
+    { 0x85ace4e3, 0x40e0b349, 0x36f81a30 }, { 0x8dd3f211, 0xe115e77b, 0xc6283adb },
+    { 0x54d106ae, 0x9983e373, 0xd3584726 }, { 0x3daa5aad, 0x8d78656f, 0xcc18bb37 },
+    { 0x711ddb62, 0xc4123507, 0x18e4fec7 }, { 0x4f1b4d80, 0x9e60df41, 0xdf95b98f },
+    { 0x4ef663d1, 0xefa3e2ad, 0x0d12eda2 }, { 0xecf66c28, 0x68a77679, 0x8abadfd2 },
+    { 0x0ea44f65, 0x002c86d3, 0x9fe63874 }, { 0x98ab4b89, 0x788fdb0d, 0xd4a88d7d },
+    { 0xdd23b252, 0x72a486f3, 0xbcbe1811 }, { 0x45a917bc, 0xbbc39583, 0x4d97c7f0 },
+    { 0x940ef03c, 0x2e1ee595, 0x06938a31 }, { 0x11c0057d, 0x38fec1b5, 0x5f63e3c9 },
+    { 0x73678f7e, 0x0da3cf63, 0xd0d8862b }, { 0x2005491b, 0x5c12f137, 0x2a491eff },
+    { 0xbed04648, 0xe2df6ecf, 0x61fd5888 }, { 0x7fb7bbd5, 0x4da3b061, 0xe3ec0442 },
+    { 0xa0c6a975, 0xd3a4051f, 0xfb102875 }, { 0x3bce09db, 0xf7fadaab, 0x8bc27d28 },
+    { 0x4122c9cd, 0x0c6c7c7b, 0x5542535b }, { 0x4e1ac4bb, 0x0126de5f, 0x759fe9a8 },
+    { 0xf7fd3697, 0x010ff4f5, 0x59bb9ead }, { 0xac1d15a2, 0xa1e6d6a9, 0x9824f7d5 },
+    { 0xe5c6e3b8, 0xf27d24d1, 0xe1e0e981 }, { 0xa3bfcbf2, 0x4f9633b7, 0xc01fc105 },
+    { 0xc823b418, 0x9a8f8d33, 0x499374b9 }, { 0xc1260410, 0xabad6953, 0x7fdbb7f9 },
+    { 0x2b0544b7, 0xf6a3c147, 0x12058ff2 }, { 0x22f3ef25, 0x7076d227, 0x1a55fd8b },
+    { 0x5978a88c, 0x7ebfde01, 0x4348a690 }, { 0xa1dff3b0, 0x20cc55c5, 0x71139069 },
+    { 0x385c5601, 0xa3f2e305, 0x02ce2214 }, { 0x36c7b4c9, 0xd06c9949, 0x731a25cc },
+    { 0x5b5a80ef, 0xc5da0977, 0x3f301aef }, { 0xaa4cd715, 0x5905710f, 0x61aeeb6c },
+    { 0x88bc23d6, 0x7cc04669, 0x98fa9669 }, { 0x66979cfd, 0x91b9325f, 0x399a800d },
+    { 0x8fd6684b, 0x4a94b6a5, 0x6015a49a }, { 0x5c379b2f, 0x3242d243, 0xf791a794 },
+    { 0x2988af9e, 0x041808c9, 0x408ce5c9 }, { 0x649ac548, 0x64b918c1, 0x8f3712c4 },
+    { 0x4a38b3e5, 0x4752b20b, 0x007bc617 }, { 0xd33517df, 0x0417d949, 0xa4a5bafa },
+    { 0x0c086539, 0x8f35f5a3, 0x5befaa30 }, { 0x2d08a177, 0x31f2bcb1, 0x8232b6d7 },
+    { 0x058fd3d4, 0xb3a13f33, 0xc22764c7 }, { 0xcde1c5fe, 0x2e075a1b, 0x1ba77d6a },
+    { 0xc6673466, 0x92c840c7, 0x2933dd0f }, { 0x33082323, 0xace4361d, 0x65be88e0 },
+    { 0x237b81dd, 0x5c794e5b, 0xe55bf620 }, { 0xc7823ffc, 0x97f68d25, 0x6db27cda },
+    { 0x4c5b7f76, 0xfe510145, 0x1c532ef5 }, { 0x97bfe0a9, 0x42666e51, 0xe62f4844 },
+    { 0x4b6a8163, 0x089b7a3f, 0x67f839cf }, { 0x7d969703, 0x92c6765f, 0x219590ef },
+    { 0x73437781, 0x56d6b6b3, 0x43922efb }, { 0x10383804, 0x4051a1df, 0x7f26015d },
+    { 0xec86b299, 0x1d63a4bb, 0xa08ce877 }, { 0xfc29cfaf, 0x4e6d4547, 0xb9038a55 },
+    { 0xa1c33d86, 0xf1958eb1, 0x1b3bd9e2 }, { 0xc132625c, 0x7c5dc3ef, 0x1254bee5 },
+    { 0x7d1a7231, 0x2ee06eed, 0x5ce6e957 }, { 0xb49a73e6, 0x83bd93bf, 0x3f8d66f0 },
+    { 0x0d4c5dde, 0x3284f695, 0xf49548d4 }, { 0x276255f3, 0x552d0541, 0x2afd23e2 },
+    { 0x0ec1ec80, 0x9c45eabb, 0x8eb40683 }, { 0xde6b3cb0, 0x960ceb47, 0xcab1938a },
+    { 0xa1462142, 0x244ec6a7, 0x7189768b }, { 0x68f480db, 0xe4f57087, 0x3223738f },
+    { 0xe7c79362, 0xed1662bb, 0xced6faeb }, { 0xe3604cc1, 0x4166c3f1, 0xa4703ac9 },
+    { 0xc04b8efa, 0xb5cd0937, 0x31dff0ac }, { 0xfd386106, 0x5d1def03, 0xaf0bf88b },
+    { 0x8dcdf54b, 0x386dee5d, 0x94975612 }, { 0x5035f270, 0xc379c1d3, 0x38782626 },
+    { 0x1bb127d6, 0x78b27f67, 0xa819a17b }, { 0x4d1d6f90, 0xa814cfbf, 0x1c7673a1 },
+    { 0x1c8868bf, 0x0566b75f, 0x8735ae95 }, { 0x85a4f399, 0x745b3eed, 0xc79b2420 },
+    { 0xcfc7baa1, 0x0ec5196b, 0x739f374a }, { 0xbc6828fc, 0x600f1181, 0x29f5d6ef },
+    { 0xf5ad3d02, 0x982f0273, 0xd62288ff }, { 0x891168c2, 0xf22e4a75, 0x0e963df2 },
+    { 0xfeb5021c, 0x0cf9fbc1, 0x3e1a3a74 }, { 0x7a373ec0, 0xb49bee07, 0x840b8e53 },
+    { 0x995ed85b, 0x6b6adfb5, 0xbb03772f }, { 0x34265c08, 0x655ace13, 0x6c1b1ec3 },
+    { 0xfac1b98a, 0x0b6c18a3, 0x02f942c1 }, { 0x2c833b71, 0xd2006111, 0x4d1697e2 },
+    { 0x69f37d15, 0x10727b1f, 0x4760f130 }, { 0x1e8a63dc, 0x9e979dc7, 0x5f68b53f },
+    { 0x3b4391ca, 0x2ef6f96f, 0x2fb7de61 }, { 0xa4476b96, 0x9ebde14d, 0xddbab14c },
+    { 0xedba6963, 0x8b292c9d, 0x109d16f5 }, { 0xe8c569d6, 0xfac3afb9, 0x428c8a3e },
+    { 0x9cbe9ded, 0x9e3f22ab, 0x1375f036 }, { 0xb7cddf9b, 0x35414741, 0x7fe9808b },
+    { 0x2e9c76d3, 0xe6b80b41, 0x8a9894a8 }, { 0x6e5bec64, 0x8d3f57d3, 0x4f6937bd },
+    { 0x99ffa8ff, 0xacf3b5d1, 0x92fdc841 }, { 0xf7364dc6, 0x56e5cc6f, 0x5b6772e9 },
+    { 0x197c3f79, 0x722cbca1, 0xf4f977e0 }, { 0x8b1ec0c0, 0x75174271, 0x4eb12b63 },
+    { 0x923d21a3, 0x7017afa5, 0x4fb23e13 }, { 0x1901d5f1, 0x89120e8b, 0x908bf9a9 }
+};
@@ -0,0 +1,46 @@
+/**
+ * @file tinymt64.c
+ *
+ * @brief Tiny Mersenne Twister only 127 bit internal state, 64 bit output
+ *
+ * @author Mutsuo Saito (Hiroshima University)
+ * @author Makoto Matsumoto (The University of Tokyo)
+ *
+ * Copyright (C) 2011 Mutsuo Saito, Makoto Matsumoto,
+ * Hiroshima University and The University of Tokyo.
+ * All rights reserved.
+ *
+ * The 3-clause BSD License is applied to this software, see
+ * LICENSE.txt
+ */
+#include "tinymt64.h"
+#define MIN_LOOP 8
+
+/**
+ * This function certificate the period of 2^127-1.
+ * @param random tinymt state vector.
+ */
+static void period_certification(tinymt64_t * random) {
+    if ((random->status[0] & TINYMT64_MASK) == 0 &&
+        random->status[1] == 0) {
+        random->status[0] = 'T';
+        random->status[1] = 'M';
+    }
+}
+
+/**
+ * This function initializes the internal state array with a 64-bit
+ * unsigned integer seed.
+ * @param random tinymt state vector.
+ * @param seed a 64-bit unsigned integer used as a seed.
+ */
+void tinymt64_init(tinymt64_t * random, uint64_t seed) {
+    random->status[0] = seed ^ ((uint64_t)random->mat1 << 32);
+    random->status[1] = random->mat2 ^ random->tmat;
+    for (unsigned int i = 1; i < MIN_LOOP; i++) {
+        random->status[i & 1] ^= i + UINT64_C(6364136223846793005)
+            * (random->status[(i - 1) & 1]
+               ^ (random->status[(i - 1) & 1] >> 62));
+    }
+    period_certification(random);
+}
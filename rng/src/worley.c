@@ -0,0 +1,128 @@
+/**
+ * @file worley.c
+ *
+ * @brief Worley (cellular) noise with hashed feature points
+ *
+ * Feature points use the 32 bit PCG LCG constants and the RXS M XS output
+ * permutation from pcg_variants.h as a coordinate hash.
+ */
+#include "worley.h"
+#include "pcg_variants.h"
+#include <math.h>
+#include <stddef.h>
+
+#define WORLEY_UNIT (1.0f / 16777216.0f)
+
+/*
+ * pcg_variants.h only provides C99 inline definitions; like pcg-output-32.c
+ * in pcg-c, emit the external one so unoptimized builds link too.
+ */
+extern inline uint32_t pcg_output_rxs_m_xs_32_32(uint32_t state);
+
+/**
+ * This function initializes the worley parameters: euclidean F1 with
+ * fully jittered feature points.
+ * @param worley worley parameters
+ * @param seed seed of the feature points
+ */
+void worley_init(worley_t * worley, uint32_t seed) {
+    worley->seed = seed;
+    worley->metric = WORLEY_EUCLIDEAN;
+    worley->output = WORLEY_F1;
+    worley->jitter = 1.0f;
+}
+
+static inline uint32_t cell_step(uint32_t state) {
+    return state * PCG_DEFAULT_MULTIPLIER_32 + PCG_DEFAULT_INCREMENT_32;
+}
+
+/* starting state of the stream of cell (x, y) */
+static inline uint32_t cell_state(uint32_t seed, int32_t x, int32_t y) {
+    uint32_t state = cell_step(seed ^ (uint32_t)x);
+    state = cell_step(pcg_output_rxs_m_xs_32_32(state) ^ (uint32_t)y);
+    return cell_step(state);
+}
+
+static inline float unit(uint32_t value) {
+    return (float)(value >> 8) * WORLEY_UNIT;
+}
+
+static inline float distance(int metric, float dx, float dy) {
+    dx = fabsf(dx);
+    dy = fabsf(dy);
+    if (metric == WORLEY_MANHATTAN) {
+        return dx + dy;
+    }
+    if (metric == WORLEY_CHEBYSHEV) {
+        return dx > dy ? dx : dy;
+    }
+    return dx * dx + dy * dy;
+}
+
+float worley_sample2(const worley_t * worley, float x, float y, float * cell) {
+    float fx = floorf(x);
+    float fy = floorf(y);
+    int32_t cx = (int32_t)fx;
+    int32_t cy = (int32_t)fy;
+    float px = x - fx;
+    float py = y - fy;
+    float margin = (1.0f - worley->jitter) * 0.5f;
+    float f1 = INFINITY;
+    float f2 = INFINITY;
+    uint32_t nearest = 0;
+
+    /*
+     * A 5x5 neighbourhood always contains the two nearest points; cells
+     * which cannot beat the current F2 are skipped before hashing.
+     */
+    for (int j = -2; j <= 2; j++) {
+        for (int i = -2; i <= 2; i++) {
+            float gx = i > 0 ? i - px : (i < 0 ? px - i - 1.0f : 0.0f);
+            float gy = j > 0 ? j - py : (j < 0 ? py - j - 1.0f : 0.0f);
+            if (distance(worley->metric, gx, gy) >= f2) {
+                continue;
+            }
+
+            uint32_t state = cell_state(worley->seed, cx + i, cy + j);
+            float fpx = margin + unit(pcg_output_rxs_m_xs_32_32(state)) * worley->jitter;
+            state = cell_step(state);
+            float fpy = margin + unit(pcg_output_rxs_m_xs_32_32(state)) * worley->jitter;
+            float d = distance(worley->metric, i + fpx - px, j + fpy - py);
+
+            if (d < f1) {
+                f2 = f1;
+                f1 = d;
+                nearest = cell_step(state);
+            } else if (d < f2) {
+                f2 = d;
+            }
+        }
+    }
+
+    if (cell) {
+        *cell = unit(pcg_output_rxs_m_xs_32_32(nearest));
+    }
+    if (worley->metric == WORLEY_EUCLIDEAN) {
+        f1 = sqrtf(f1);
+        f2 = sqrtf(f2);
+    }
+    if (worley->output == WORLEY_F2) {
+        return f2;
+    }
+    if (worley->output == WORLEY_F2_F1) {
+        return f2 - f1;
+    }
+    return f1;
+}
+
+void worley_fill_grid(const worley_t * worley, float * out, uint32_t stride,
+                      float x0, float y0, float dx, float dy,
+                      uint32_t w, uint32_t h) {
+    for (uint32_t j = 0; j < h; j++) {
+        float y = y0 + (float)j * dy;
+        float * row = out + (size_t)j * w * stride;
+        for (uint32_t i = 0; i < w; i++) {
+            row[i * stride] = worley_sample2(worley, x0 + (float)i * dx, y, NULL);
+        }
+    }
+}
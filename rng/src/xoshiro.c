@@ -0,0 +1,101 @@
+/**
+ * @file xoshiro.c
+ *
+ * @brief xoshiro128++ and xoshiro256++ seeding and jump functions
+ *
+ * Derived from the public domain reference implementations by
+ * David Blackman and Sebastiano Vigna (http://prng.di.unimi.it).
+ */
+#include "xoshiro.h"
+
+uint64_t splitmix64_next(uint64_t * x) {
+    uint64_t z = (*x += UINT64_C(0x9e3779b97f4a7c15));
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+    return z ^ (z >> 31);
+}
+
+/**
+ * This function initializes the state from a 64 bit seed, expanded with
+ * splitmix64 as recommended by the authors (never all zeros).
+ */
+void xoshiro128_init(xoshiro128_t * random, uint64_t seed) {
+    uint64_t a = splitmix64_next(&seed);
+    uint64_t b = splitmix64_next(&seed);
+    random->s[0] = (uint32_t)a;
+    random->s[1] = (uint32_t)(a >> 32);
+    random->s[2] = (uint32_t)b;
+    random->s[3] = (uint32_t)(b >> 32);
+}
+
+void xoshiro256_init(xoshiro256_t * random, uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        random->s[i] = splitmix64_next(&seed);
+    }
+}
+
+static void xoshiro128_apply(xoshiro128_t * random, const uint32_t jump[4]) {
+    uint32_t s[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 32; b++) {
+            if (jump[i] & UINT32_C(1) << b) {
+                s[0] ^= random->s[0];
+                s[1] ^= random->s[1];
+                s[2] ^= random->s[2];
+                s[3] ^= random->s[3];
+            }
+            xoshiro128_next(random);
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        random->s[i] = s[i];
+    }
+}
+
+static void xoshiro256_apply(xoshiro256_t * random, const uint64_t jump[4]) {
+    uint64_t s[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (jump[i] & UINT64_C(1) << b) {
+                s[0] ^= random->s[0];
+                s[1] ^= random->s[1];
+                s[2] ^= random->s[2];
+                s[3] ^= random->s[3];
+            }
+            xoshiro256_next(random);
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        random->s[i] = s[i];
+    }
+}
+
+void xoshiro128_jump(xoshiro128_t * random) {
+    static const uint32_t jump[4] = {
+        0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b
+    };
+    xoshiro128_apply(random, jump);
+}
+
+void xoshiro128_long_jump(xoshiro128_t * random) {
+    static const uint32_t jump[4] = {
+        0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662
+    };
+    xoshiro128_apply(random, jump);
+}
+
+void xoshiro256_jump(xoshiro256_t * random) {
+    static const uint64_t jump[4] = {
+        UINT64_C(0x180ec6d33cfd0aba), UINT64_C(0xd5a61266f0c9392c),
+        UINT64_C(0xa9582618e03fc9aa), UINT64_C(0x39abdc4529b1661c)
+    };
+    xoshiro256_apply(random, jump);
+}
+
+void xoshiro256_long_jump(xoshiro256_t * random) {
+    static const uint64_t jump[4] = {
+        UINT64_C(0x76e15d3efefdcbbf), UINT64_C(0xc5004e441c522fb3),
+        UINT64_C(0x77710069854ee241), UINT64_C(0x39109bb02acbe635)
+    };
+    xoshiro256_apply(random, jump);
+}